@@ -22,4 +22,21 @@
 #pragma once
 
 /* Network */
+#include <Vector/DBC/Arena.h>
+#include <Vector/DBC/FlatNetwork.h>
+#include <Vector/DBC/MappedFile.h>
 #include <Vector/DBC/Network.h>
+#include <Vector/DBC/NetworkView.h>
+#include <Vector/DBC/NetworkWriter.h>
+#include <Vector/DBC/Snapshot.h>
+
+/* Lookup */
+#include <Vector/DBC/MessageIndex.h>
+#include <Vector/DBC/SignalIndex.h>
+
+/* Decoding */
+#include <Vector/DBC/ColumnDecoder.h>
+#include <Vector/DBC/CompiledSignal.h>
+#include <Vector/DBC/FrameRecord.h>
+#include <Vector/DBC/MessageDecoder.h>
+#include <Vector/DBC/ValueDescriptionTable.h>
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/Arena.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+namespace Vector {
+namespace DBC {
+
+/** maximum size of a block, larger allocations get their own block */
+static const std::size_t maximumBlockSize = 0x1000000;
+
+/** current arena of this thread */
+static thread_local Arena * currentArena = nullptr;
+
+Arena::Arena(std::size_t initialBlockSize) :
+    nextBlockSize(std::max<std::size_t>(initialBlockSize, 0x100)) {
+}
+
+Arena::~Arena() {
+    while (lastBlock != nullptr) {
+        Block * previous = lastBlock->previous;
+        std::free(lastBlock);
+        lastBlock = previous;
+    }
+}
+
+void * Arena::allocate(std::size_t size, std::size_t alignment) {
+    /* fits into last block */
+    if (next != nullptr) {
+        const std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(next) + alignment - 1) & ~(alignment - 1);
+        const std::size_t padding = address - reinterpret_cast<std::uintptr_t>(next);
+        if (padding + size <= static_cast<std::size_t>(end - next)) {
+            next = reinterpret_cast<char *>(address + size);
+            return reinterpret_cast<void *>(address);
+        }
+    }
+
+    /* new block */
+    const std::size_t blockSize = std::max(nextBlockSize, sizeof(Block) + alignment + size);
+    Block * block = static_cast<Block *>(std::malloc(blockSize));
+    if (block == nullptr)
+        throw std::bad_alloc();
+    block->previous = lastBlock;
+    lastBlock = block;
+    totalBlockSize += blockSize;
+    nextBlockSize = std::min(2 * nextBlockSize, maximumBlockSize);
+
+    next = reinterpret_cast<char *>(block + 1);
+    end = reinterpret_cast<char *>(block) + blockSize;
+    const std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(next) + alignment - 1) & ~(alignment - 1);
+    next = reinterpret_cast<char *>(address + size);
+    return reinterpret_cast<void *>(address);
+}
+
+Arena * Arena::current() {
+    return currentArena;
+}
+
+ArenaScope::ArenaScope(Arena & arena) :
+    previous(currentArena) {
+    currentArena = &arena;
+}
+
+ArenaScope::~ArenaScope() {
+    currentArena = previous;
+}
+
+}
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <new>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Arena
+ *
+ * Monotonic allocator, which hands out memory from large blocks by
+ * incrementing a pointer. Deallocation does nothing, all blocks are
+ * released at once when the arena is destroyed. Blocks grow
+ * geometrically, so large networks need only a few of them.
+ *
+ * An arena is used by one thread at a time.
+ */
+class VECTOR_DBC_EXPORT Arena {
+  public:
+    /**
+     * @brief Constructor
+     * @param[in] initialBlockSize Size of the first block
+     */
+    explicit Arena(std::size_t initialBlockSize = 0x10000);
+
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    /**
+     * @brief Allocate memory
+     * @param[in] size Size
+     * @param[in] alignment Alignment (power of two)
+     * @return Memory
+     */
+    void * allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief Get size of all blocks
+     * @return Size in bytes
+     */
+    std::size_t blockSize() const {
+        return totalBlockSize;
+    }
+
+    /**
+     * @brief Get current arena of this thread
+     * @return Arena (nullptr if containers allocate from the heap)
+     */
+    static Arena * current();
+
+  private:
+    /** Block Header */
+    struct Block {
+        /** Previous Block */
+        Block * previous;
+    };
+
+    /** last allocated block */
+    Block * lastBlock {};
+
+    /** next free byte in last block */
+    char * next {};
+
+    /** end of last block */
+    char * end {};
+
+    /** size of next block */
+    std::size_t nextBlockSize;
+
+    /** size of all blocks */
+    std::size_t totalBlockSize {};
+};
+
+/**
+ * Arena Scope
+ *
+ * Makes an arena the current arena of this thread for the lifetime of
+ * the scope. Containers of the network (ArenaMap, ArenaSet, ArenaVector),
+ * which are created within the scope, allocate from this arena, e.g.
+ * while loading a network:
+ *
+ * @code
+ * Vector::DBC::Arena arena;
+ * Vector::DBC::ArenaScope scope(arena);
+ * Vector::DBC::Network network;
+ * Vector::DBC::loadFile(network, fileName);
+ * @endcode
+ *
+ * Containers keep their arena after the scope ends, so the arena must
+ * outlive the network. Copies of containers allocate from the current
+ * arena of the copying thread.
+ * loadBuffer parses messages in additional threads into networks on the
+ * heap, and copies them into the arena of the calling thread when it
+ * merges them, so the arena is only used by the calling thread.
+ */
+class VECTOR_DBC_EXPORT ArenaScope {
+  public:
+    /**
+     * @brief Make arena the current arena
+     * @param[in] arena Arena
+     */
+    explicit ArenaScope(Arena & arena);
+
+    /** Restore previous arena */
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope & operator=(const ArenaScope &) = delete;
+
+  private:
+    /** previous arena */
+    Arena * previous;
+};
+
+/**
+ * Arena Allocator
+ *
+ * Standard allocator, which allocates from the arena that was current
+ * on construction, or from the heap if there was none. The arena moves
+ * with the container on move construction and swaps with it. Move
+ * assignment keeps the arena of the target, so elements of a container
+ * from another arena (or the heap) are moved one by one into it. Their
+ * own containers still keep the other arena, which is why
+ * Network::operator= copies them instead.
+ */
+template<typename T>
+class ArenaAllocator {
+  public:
+    /** Value Type */
+    using value_type = T;
+
+    /** Move assignment keeps the arena of the target container */
+    using propagate_on_container_move_assignment = std::false_type;
+
+    /** Arena swaps with the container */
+    using propagate_on_container_swap = std::true_type;
+
+    /** Create allocator for current arena */
+    ArenaAllocator() noexcept :
+        arena(Arena::current()) {
+    }
+
+    /**
+     * @brief Create allocator for same arena
+     * @param[in] other Other allocator
+     */
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U> & other) noexcept :
+        arena(other.arena) {
+    }
+
+    /**
+     * @brief Allocate memory
+     * @param[in] n Number of elements
+     * @return Memory
+     */
+    T * allocate(std::size_t n) {
+        if (arena != nullptr)
+            return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    /**
+     * @brief Deallocate memory (only heap memory)
+     * @param[in] p Memory
+     */
+    void deallocate(T * p, std::size_t /*n*/) noexcept {
+        if (arena == nullptr)
+            ::operator delete(p);
+    }
+
+    /**
+     * @brief Allocator for copies of containers
+     * @return Allocator for current arena
+     */
+    ArenaAllocator select_on_container_copy_construction() const noexcept {
+        return ArenaAllocator();
+    }
+
+    /** arena (nullptr for heap) */
+    Arena * arena;
+};
+
+template<typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) noexcept {
+    return lhs.arena == rhs.arena;
+}
+
+template<typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) noexcept {
+    return lhs.arena != rhs.arena;
+}
+
+/**
+ * std::map allocating from an arena
+ *
+ * A default constructed container binds to the current arena of the
+ * constructing thread (see ArenaScope), or to the heap if there is none.
+ */
+template<typename Key, typename T, typename Compare = std::less<Key>>
+using ArenaMap = std::map<Key, T, Compare, ArenaAllocator<std::pair<const Key, T>>>;
+
+/**
+ * std::set allocating from an arena
+ *
+ * @copydetails ArenaMap
+ */
+template<typename Key, typename Compare = std::less<Key>>
+using ArenaSet = std::set<Key, Compare, ArenaAllocator<Key>>;
+
+/**
+ * std::vector allocating from an arena
+ *
+ * @copydetails ArenaMap
+ */
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}
+}
@@ -27,6 +27,7 @@
 #include <string>
 
 #include <Vector/DBC/AttributeObjectType.h>
+#include <Vector/DBC/Symbol.h>
 
 #include <Vector/DBC/vector_dbc_export.h>
 
@@ -41,7 +42,7 @@ namespace DBC {
  */
 struct VECTOR_DBC_EXPORT Attribute {
     /** Name */
-    std::string name {};
+    Symbol name {};
 
     /** Value Type */
     AttributeObjectType objectType { AttributeObjectType::Network };
@@ -27,6 +27,7 @@
 #include <string>
 
 #include <Vector/DBC/Attribute.h>
+#include <Vector/DBC/Symbol.h>
 
 #include <Vector/DBC/vector_dbc_export.h>
 
@@ -38,7 +39,7 @@ namespace DBC {
  */
 struct VECTOR_DBC_EXPORT AttributeRelation : Attribute {
     /** Node Name */
-    std::string nodeName {};
+    Symbol nodeName {};
 
     /** Environment Variable Name */
     std::string environmentVariableName {};
@@ -28,6 +28,8 @@
 #include <string>
 #include <vector>
 
+#include <Vector/DBC/Arena.h>
+
 #include <Vector/DBC/vector_dbc_export.h>
 
 namespace Vector {
@@ -77,7 +79,7 @@ struct VECTOR_DBC_EXPORT AttributeValueType {
     };
 
     /** Values of type AttributeValueType::Enum */
-    std::vector<std::string> enumValues {};
+    ArenaVector<std::string> enumValues {};
 };
 
 std::ostream & operator<<(std::ostream & os, const AttributeValueType & attributeValueType);
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <atomic>
+#include <cstring>
+
+#include <Vector/DBC/ColumnDecoder.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_DBC_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace Vector {
+namespace DBC {
+
+/** Kernel */
+enum class Kernel {
+    /** Scalar */
+    Scalar,
+
+    /** SSE4.1, two payloads per iteration */
+    Sse41,
+
+    /** AVX2, four payloads per iteration */
+    Avx2
+};
+
+/**
+ * @brief Check if the CPU supports a kernel
+ * @param[in] kernel Kernel
+ * @return true if supported
+ */
+static bool isSupported(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Scalar:
+        return true;
+#ifdef VECTOR_DBC_X86_KERNELS
+    case Kernel::Sse41:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.1");
+    case Kernel::Avx2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+    case Kernel::Sse41:
+    case Kernel::Avx2:
+        break;
+#endif
+    }
+    return false;
+}
+
+/**
+ * @brief Select best kernel supported by the CPU
+ * @return Kernel
+ */
+static Kernel selectKernel() {
+    if (isSupported(Kernel::Avx2))
+        return Kernel::Avx2;
+    if (isSupported(Kernel::Sse41))
+        return Kernel::Sse41;
+    return Kernel::Scalar;
+}
+
+/**
+ * @brief Get selected kernel
+ * @return Kernel
+ */
+static std::atomic<Kernel> & selectedKernel() {
+    static std::atomic<Kernel> kernel { selectKernel() };
+    return kernel;
+}
+
+/**
+ * @brief Get selected kernel
+ * @return Kernel
+ */
+static Kernel kernel() {
+    return selectedKernel().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Scalar kernel
+ * @param[in] signal Compiled Signal
+ * @param[in] data First Payload
+ * @param[in] stride Distance between payloads
+ * @param[in] count Number of payloads
+ * @param[out] values Physical Values
+ */
+template<typename T>
+static void decodeScalar(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, T * values) {
+    for (std::size_t k = 0; k < count; ++k)
+        values[k] = static_cast<T>(signal.decodePhysicalValue(data + k * stride));
+}
+
+#ifdef VECTOR_DBC_X86_KERNELS
+/**
+ * Vector kernel parameters
+ *
+ * The raw value is converted to double by setting the exponent of 2^52:
+ * For x < 2^52 the double with bit pattern (x | 0x4330000000000000) is
+ * exactly 2^52 + x. Signed values are biased by flipping their sign bit
+ * first, which is removed together with 2^52 afterwards.
+ */
+struct KernelParameters {
+    /** Raw Value Mask */
+    uint64_t rawMask;
+
+    /** Sign Bit (0 for unsigned values) */
+    uint64_t signBit;
+
+    /** Bias (2^52 + signBit) */
+    double bias;
+};
+
+/** Exponent of 2^52 */
+static const uint64_t doubleMagic = UINT64_C(0x4330000000000000);
+
+/**
+ * @brief Load 64-bit word
+ * @param[in] data Data
+ * @return Word in host byte order
+ */
+static inline uint64_t loadWord(const uint8_t * data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/**
+ * @brief Store four doubles
+ * @param[out] values Values
+ * @param[in] value Value
+ */
+__attribute__((target("avx2")))
+static inline void storeAvx2(double * values, __m256d value) {
+    _mm256_storeu_pd(values, value);
+}
+
+/**
+ * @brief Store four doubles as floats
+ * @param[out] values Values
+ * @param[in] value Value
+ */
+__attribute__((target("avx2")))
+static inline void storeAvx2(float * values, __m256d value) {
+    _mm_storeu_ps(values, _mm256_cvtpd_ps(value));
+}
+
+/**
+ * @brief AVX2 kernel
+ * @param[in] signal Compiled Signal
+ * @param[in] parameters Kernel Parameters
+ * @param[in] data First Payload
+ * @param[in] stride Distance between payloads
+ * @param[in] count Number of payloads
+ * @param[out] values Physical Values
+ */
+template<typename T>
+__attribute__((target("avx2")))
+static void decodeAvx2(const CompiledSignal & signal, const KernelParameters & parameters, const uint8_t * data, std::size_t stride, std::size_t count, T * values) {
+    const __m256i byteSwap = _mm256_setr_epi8(
+                                 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const __m256i offsets = _mm256_setr_epi64x(0, static_cast<int64_t>(stride), static_cast<int64_t>(2 * stride), static_cast<int64_t>(3 * stride));
+    const __m128i shift = _mm_cvtsi32_si128(signal.shift);
+    const __m256i rawMask = _mm256_set1_epi64x(static_cast<int64_t>(parameters.rawMask));
+    const __m256i signBit = _mm256_set1_epi64x(static_cast<int64_t>(parameters.signBit));
+    const __m256i magic = _mm256_set1_epi64x(static_cast<int64_t>(doubleMagic));
+    const __m256d bias = _mm256_set1_pd(parameters.bias);
+    const __m256d factor = _mm256_set1_pd(signal.factor);
+    const __m256d offset = _mm256_set1_pd(signal.offset);
+
+    /* gather, byte swap, shift, mask, convert, scale */
+    const uint8_t * word = data + signal.byteOffset;
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        __m256i rawValue = _mm256_i64gather_epi64(reinterpret_cast<const long long *>(word + k * stride), offsets, 1);
+        if (signal.bigEndian)
+            rawValue = _mm256_shuffle_epi8(rawValue, byteSwap);
+        rawValue = _mm256_and_si256(_mm256_srl_epi64(rawValue, shift), rawMask);
+        rawValue = _mm256_or_si256(_mm256_xor_si256(rawValue, signBit), magic);
+        const __m256d value = _mm256_sub_pd(_mm256_castsi256_pd(rawValue), bias);
+        storeAvx2(values + k, _mm256_add_pd(_mm256_mul_pd(value, factor), offset));
+    }
+
+    /* remaining payloads */
+    decodeScalar(signal, data + k * stride, stride, count - k, values + k);
+}
+
+/**
+ * @brief Store two doubles
+ * @param[out] values Values
+ * @param[in] value Value
+ */
+__attribute__((target("sse4.1")))
+static inline void storeSse41(double * values, __m128d value) {
+    _mm_storeu_pd(values, value);
+}
+
+/**
+ * @brief Store two doubles as floats
+ * @param[out] values Values
+ * @param[in] value Value
+ */
+__attribute__((target("sse4.1")))
+static inline void storeSse41(float * values, __m128d value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(values), _mm_castps_si128(_mm_cvtpd_ps(value)));
+}
+
+/**
+ * @brief SSE4.1 kernel
+ * @param[in] signal Compiled Signal
+ * @param[in] parameters Kernel Parameters
+ * @param[in] data First Payload
+ * @param[in] stride Distance between payloads
+ * @param[in] count Number of payloads
+ * @param[out] values Physical Values
+ */
+template<typename T>
+__attribute__((target("sse4.1")))
+static void decodeSse41(const CompiledSignal & signal, const KernelParameters & parameters, const uint8_t * data, std::size_t stride, std::size_t count, T * values) {
+    const __m128i byteSwap = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const __m128i shift = _mm_cvtsi32_si128(signal.shift);
+    const __m128i rawMask = _mm_set1_epi64x(static_cast<int64_t>(parameters.rawMask));
+    const __m128i signBit = _mm_set1_epi64x(static_cast<int64_t>(parameters.signBit));
+    const __m128i magic = _mm_set1_epi64x(static_cast<int64_t>(doubleMagic));
+    const __m128d bias = _mm_set1_pd(parameters.bias);
+    const __m128d factor = _mm_set1_pd(signal.factor);
+    const __m128d offset = _mm_set1_pd(signal.offset);
+
+    /* load, byte swap, shift, mask, convert, scale */
+    const uint8_t * word = data + signal.byteOffset;
+    std::size_t k = 0;
+    for (; k + 2 <= count; k += 2) {
+        __m128i rawValue = _mm_set_epi64x(static_cast<int64_t>(loadWord(word + (k + 1) * stride)), static_cast<int64_t>(loadWord(word + k * stride)));
+        if (signal.bigEndian)
+            rawValue = _mm_shuffle_epi8(rawValue, byteSwap);
+        rawValue = _mm_and_si128(_mm_srl_epi64(rawValue, shift), rawMask);
+        rawValue = _mm_or_si128(_mm_xor_si128(rawValue, signBit), magic);
+        const __m128d value = _mm_sub_pd(_mm_castsi128_pd(rawValue), bias);
+        storeSse41(values + k, _mm_add_pd(_mm_mul_pd(value, factor), offset));
+    }
+
+    /* remaining payloads */
+    decodeScalar(signal, data + k * stride, stride, count - k, values + k);
+}
+#endif
+
+/**
+ * @brief Decode with the selected kernel
+ * @param[in] signal Compiled Signal
+ * @param[in] data First Payload
+ * @param[in] stride Distance between payloads
+ * @param[in] count Number of payloads
+ * @param[out] values Physical Values
+ */
+template<typename T>
+static void decodeColumn(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, T * values) {
+#ifdef VECTOR_DBC_X86_KERNELS
+    /* vector kernels need a single word and an exact conversion to double */
+    const unsigned int bitSize = 64 - signal.signShift;
+    if ((signal.extraMask == 0) && (signal.rawMask != 0) && (bitSize <= 52)) {
+        KernelParameters parameters;
+        parameters.rawMask = signal.rawMask;
+        parameters.signBit = signal.isSigned ? (UINT64_C(1) << (bitSize - 1)) : 0;
+        parameters.bias = 4503599627370496.0 + static_cast<double>(parameters.signBit);
+        switch (kernel()) {
+        case Kernel::Avx2:
+            decodeAvx2(signal, parameters, data, stride, count, values);
+            return;
+        case Kernel::Sse41:
+            decodeSse41(signal, parameters, data, stride, count, values);
+            return;
+        case Kernel::Scalar:
+            break;
+        }
+    }
+#endif
+    decodeScalar(signal, data, stride, count, values);
+}
+
+void ColumnDecoder::decode(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, double * values) {
+    decodeColumn(signal, data, stride, count, values);
+}
+
+void ColumnDecoder::decode(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, float * values) {
+    decodeColumn(signal, data, stride, count, values);
+}
+
+bool ColumnDecoder::setImplementation(const char * name) {
+    Kernel newKernel;
+    if (name == nullptr)
+        newKernel = selectKernel();
+    else if (std::strcmp(name, "avx2") == 0)
+        newKernel = Kernel::Avx2;
+    else if (std::strcmp(name, "sse4.1") == 0)
+        newKernel = Kernel::Sse41;
+    else if (std::strcmp(name, "scalar") == 0)
+        newKernel = Kernel::Scalar;
+    else
+        return false;
+    if (!isSupported(newKernel))
+        return false;
+    selectedKernel().store(newKernel, std::memory_order_relaxed);
+    return true;
+}
+
+const char * ColumnDecoder::implementation() {
+    switch (kernel()) {
+    case Kernel::Avx2:
+        return "avx2";
+    case Kernel::Sse41:
+        return "sse4.1";
+    case Kernel::Scalar:
+        break;
+    }
+    return "scalar";
+}
+
+}
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC/CompiledSignal.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Column Decoder
+ *
+ * Decodes one signal from many payloads into physical values.
+ * On x86 the kernel is selected at runtime (AVX2, SSE4.1 or scalar),
+ * or can be chosen with setImplementation, e.g. to compare the kernels.
+ * The vector kernels handle signals of up to 52 bits, which convert
+ * exactly to double. Wider signals are decoded by the scalar kernel.
+ * All kernels produce the same values as CompiledSignal::decodePhysicalValue.
+ */
+class VECTOR_DBC_EXPORT ColumnDecoder {
+  public:
+    /**
+     * @brief Decode signal from payloads into physical values
+     * @param[in] signal Compiled Signal
+     * @param[in] data First Payload
+     * @param[in] stride Distance between payloads (at least signal.dataSize)
+     * @param[in] count Number of payloads
+     * @param[out] values Physical Values (count many)
+     */
+    static void decode(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, double * values);
+
+    /**
+     * @brief Decode signal from payloads into physical values
+     * @param[in] signal Compiled Signal
+     * @param[in] data First Payload
+     * @param[in] stride Distance between payloads (at least signal.dataSize)
+     * @param[in] count Number of payloads
+     * @param[out] values Physical Values (count many)
+     */
+    static void decode(const CompiledSignal & signal, const uint8_t * data, std::size_t stride, std::size_t count, float * values);
+
+    /**
+     * @brief Get name of the selected kernel
+     * @return "avx2", "sse4.1" or "scalar"
+     */
+    static const char * implementation();
+
+    /**
+     * @brief Select kernel for all threads
+     * @param[in] name "avx2", "sse4.1", "scalar" or nullptr for the best kernel supported by the CPU
+     * @return false if the kernel is unknown or not supported by the CPU
+     */
+    static bool setImplementation(const char * name);
+};
+
+}
+}
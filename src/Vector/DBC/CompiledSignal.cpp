@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <algorithm>
+
+#include <Vector/DBC/CompiledSignal.h>
+
+namespace Vector {
+namespace DBC {
+
+CompiledSignal::CompiledSignal(const Signal & signal) :
+    CompiledSignal(signal.startBit, signal.bitSize, signal.byteOrder, signal.valueType, signal.factor, signal.offset)
+{
+}
+
+CompiledSignal::CompiledSignal(uint32_t startBit, uint32_t bitSize, ByteOrder byteOrder, ValueType valueType, double factor, double offset) :
+    factor(factor),
+    offset(offset),
+    bigEndian(byteOrder == ByteOrder::BigEndian),
+    isSigned(valueType == ValueType::Signed)
+{
+    /* safety check */
+    if ((bitSize == 0) || (bitSize > 64))
+        return;
+
+    /* bytes covered by the signal */
+    const uint32_t firstByte = startBit / 8;
+    uint32_t lastByte;
+    uint32_t lsbPosition;
+    if (byteOrder == ByteOrder::BigEndian) {
+        /* position of LSB, counted from the MSB of byte 0 */
+        lsbPosition = (firstByte * 8) + (7 - (startBit % 8)) + bitSize - 1;
+        lastByte = lsbPosition / 8;
+    } else {
+        /* position of LSB, counted from the LSB of byte 0 */
+        lsbPosition = startBit;
+        lastByte = (startBit + bitSize - 1) / 8;
+    }
+    if (lastByte >= UINT16_MAX)
+        return;
+    dataSize = static_cast<uint16_t>(std::max<uint32_t>(8, lastByte + 1));
+
+    /* place the word, so that it stays within dataSize */
+    if (byteOrder == ByteOrder::BigEndian) {
+        /* word ends at the LSB byte, an extra 9th byte is in front of it */
+        byteOffset = static_cast<uint16_t>((lastByte >= 7) ? (lastByte - 7) : 0);
+        shift = static_cast<uint8_t>(8 * (byteOffset + 7 - lastByte) + 7 - (lsbPosition % 8));
+        extraByteOffset = static_cast<uint16_t>((lastByte - firstByte == 8) ? firstByte : byteOffset);
+    } else {
+        /* word starts at the LSB byte, an extra 9th byte is behind it */
+        byteOffset = static_cast<uint16_t>(std::min<uint32_t>(firstByte, dataSize - 8));
+        shift = static_cast<uint8_t>(lsbPosition - 8 * byteOffset);
+        extraByteOffset = static_cast<uint16_t>((lastByte - firstByte == 8) ? lastByte : byteOffset);
+    }
+
+    /* masks */
+    signShift = static_cast<uint8_t>(64 - bitSize);
+    rawMask = ~0ULL >> signShift;
+    valueMask = isSigned ? ~0ULL : rawMask;
+    if (lastByte - firstByte == 8) {
+        extraShift = static_cast<uint8_t>(64 - shift);
+        extraMask = static_cast<uint8_t>(rawMask >> extraShift);
+    }
+}
+
+}
+}
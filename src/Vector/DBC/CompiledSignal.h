@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstdint>
+
+#include <Vector/DBC/Signal.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Compiled Signal
+ *
+ * Decode/encode descriptor, which is precomputed once from a Signal.
+ * It only contains what is needed on the hot path, so that decoding is
+ * a branch-free sequence of one word load, shifts and masks.
+ */
+struct VECTOR_DBC_EXPORT CompiledSignal {
+    CompiledSignal() = default;
+
+    /**
+     * @brief Compile a signal
+     * @param[in] signal Signal
+     *
+     * Signals with a bit size of 0 or more than 64 compile into a descriptor
+     * that decodes to 0 and doesn't encode anything.
+     */
+    explicit CompiledSignal(const Signal & signal);
+
+    /**
+     * @brief Compile a signal from its decode fields
+     * @param[in] startBit Start Bit
+     * @param[in] bitSize Bit Size
+     * @param[in] byteOrder Byte Order
+     * @param[in] valueType Value Type
+     * @param[in] factor Factor
+     * @param[in] offset Offset
+     */
+    CompiledSignal(uint32_t startBit, uint32_t bitSize, ByteOrder byteOrder, ValueType valueType, double factor, double offset);
+
+    /** Raw Value Mask (bit size many ones) */
+    uint64_t rawMask {};
+
+    /** Value Mask applied after sign extension (all ones for signed values) */
+    uint64_t valueMask {};
+
+    /** Factor */
+    double factor {};
+
+    /** Offset */
+    double offset {};
+
+    /** Byte Offset of the 64-bit word covering the signal */
+    uint16_t byteOffset {};
+
+    /** Byte Offset of the extra byte of signals covering 9 bytes */
+    uint16_t extraByteOffset {};
+
+    /** Minimum Data Size needed by decode/encode */
+    uint16_t dataSize { 8 };
+
+    /** Shift of the LSB within the word */
+    uint8_t shift {};
+
+    /** Shift of the extra byte */
+    uint8_t extraShift {};
+
+    /** Mask of the extra byte (0 if the signal covers at most 8 bytes) */
+    uint8_t extraMask {};
+
+    /** Sign Extension Shift (64 - bit size) */
+    uint8_t signShift {};
+
+    /** Big Endian (Motorola) word */
+    bool bigEndian {};
+
+    /** Signed Value */
+    bool isSigned {};
+
+    /**
+     * @brief Decodes/Extracts the signal from the message data
+     * @param[in] data Data (at least dataSize bytes)
+     * @return Raw signal value
+     */
+    uint64_t decode(const uint8_t * data) const {
+        const uint8_t * word = data + byteOffset;
+        uint64_t rawValue = (bigEndian ? loadBigEndian(word) : loadLittleEndian(word)) >> shift;
+        rawValue |= static_cast<uint64_t>(data[extraByteOffset] & extraMask) << extraShift;
+        rawValue = static_cast<uint64_t>(static_cast<int64_t>(rawValue << signShift) >> signShift);
+        return rawValue & valueMask;
+    }
+
+    /**
+     * @brief Encodes the signal into the message data
+     * @param[inout] data Data (at least dataSize bytes)
+     * @param[in] rawValue Raw signal value
+     */
+    void encode(uint8_t * data, uint64_t rawValue) const {
+        uint8_t * word = data + byteOffset;
+        rawValue &= rawMask;
+        if (bigEndian)
+            storeBigEndian(word, (loadBigEndian(word) & ~(rawMask << shift)) | (rawValue << shift));
+        else
+            storeLittleEndian(word, (loadLittleEndian(word) & ~(rawMask << shift)) | (rawValue << shift));
+        data[extraByteOffset] = static_cast<uint8_t>((data[extraByteOffset] & ~extraMask) | ((rawValue >> extraShift) & extraMask));
+    }
+
+    /**
+     * @brief Convert from Raw to Physical Value
+     * @param[in] rawValue Raw signal value as returned by decode
+     * @return Physical Value
+     */
+    double rawToPhysicalValue(uint64_t rawValue) const {
+        /* physicalValue = rawValue * factor + offset */
+        const double value = isSigned ? static_cast<double>(static_cast<int64_t>(rawValue)) : static_cast<double>(rawValue);
+        return value * factor + offset;
+    }
+
+    /**
+     * @brief Decodes the signal and converts it to physical value
+     * @param[in] data Data (at least dataSize bytes)
+     * @return Physical Value
+     */
+    double decodePhysicalValue(const uint8_t * data) const {
+        return rawToPhysicalValue(decode(data));
+    }
+
+    /**
+     * @brief Load a 64-bit little endian word
+     * @param[in] data Data (at least 8 bytes)
+     * @return Word
+     *
+     * Compilers combine this into a single unaligned load.
+     */
+    static uint64_t loadLittleEndian(const uint8_t * data) {
+        return
+            (static_cast<uint64_t>(data[0]) << 0) |
+            (static_cast<uint64_t>(data[1]) << 8) |
+            (static_cast<uint64_t>(data[2]) << 16) |
+            (static_cast<uint64_t>(data[3]) << 24) |
+            (static_cast<uint64_t>(data[4]) << 32) |
+            (static_cast<uint64_t>(data[5]) << 40) |
+            (static_cast<uint64_t>(data[6]) << 48) |
+            (static_cast<uint64_t>(data[7]) << 56);
+    }
+
+    /**
+     * @brief Load a 64-bit big endian word
+     * @param[in] data Data (at least 8 bytes)
+     * @return Word
+     *
+     * Compilers combine this into a single unaligned load and a byte swap.
+     */
+    static uint64_t loadBigEndian(const uint8_t * data) {
+        return
+            (static_cast<uint64_t>(data[0]) << 56) |
+            (static_cast<uint64_t>(data[1]) << 48) |
+            (static_cast<uint64_t>(data[2]) << 40) |
+            (static_cast<uint64_t>(data[3]) << 32) |
+            (static_cast<uint64_t>(data[4]) << 24) |
+            (static_cast<uint64_t>(data[5]) << 16) |
+            (static_cast<uint64_t>(data[6]) << 8) |
+            (static_cast<uint64_t>(data[7]) << 0);
+    }
+
+    /**
+     * @brief Store a 64-bit little endian word
+     * @param[out] data Data (at least 8 bytes)
+     * @param[in] word Word
+     *
+     * Compilers combine this into a single unaligned store.
+     */
+    static void storeLittleEndian(uint8_t * data, uint64_t word) {
+        data[0] = static_cast<uint8_t>(word >> 0);
+        data[1] = static_cast<uint8_t>(word >> 8);
+        data[2] = static_cast<uint8_t>(word >> 16);
+        data[3] = static_cast<uint8_t>(word >> 24);
+        data[4] = static_cast<uint8_t>(word >> 32);
+        data[5] = static_cast<uint8_t>(word >> 40);
+        data[6] = static_cast<uint8_t>(word >> 48);
+        data[7] = static_cast<uint8_t>(word >> 56);
+    }
+
+    /**
+     * @brief Store a 64-bit big endian word
+     * @param[out] data Data (at least 8 bytes)
+     * @param[in] word Word
+     *
+     * Compilers combine this into a byte swap and a single unaligned store.
+     */
+    static void storeBigEndian(uint8_t * data, uint64_t word) {
+        data[0] = static_cast<uint8_t>(word >> 56);
+        data[1] = static_cast<uint8_t>(word >> 48);
+        data[2] = static_cast<uint8_t>(word >> 40);
+        data[3] = static_cast<uint8_t>(word >> 32);
+        data[4] = static_cast<uint8_t>(word >> 24);
+        data[5] = static_cast<uint8_t>(word >> 16);
+        data[6] = static_cast<uint8_t>(word >> 8);
+        data[7] = static_cast<uint8_t>(word >> 0);
+    }
+};
+
+}
+}
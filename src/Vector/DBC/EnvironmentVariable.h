@@ -29,7 +29,9 @@
 #include <set>
 #include <string>
 
+#include <Vector/DBC/Arena.h>
 #include <Vector/DBC/Attribute.h>
+#include <Vector/DBC/Symbol.h>
 #include <Vector/DBC/ValueDescriptions.h>
 
 #include <Vector/DBC/vector_dbc_export.h>
@@ -39,6 +41,8 @@ namespace DBC {
 
 /**
  * Environment Variable (EV)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT EnvironmentVariable {
     /** Name */
@@ -96,7 +100,7 @@ struct VECTOR_DBC_EXPORT EnvironmentVariable {
     AccessType accessType { AccessType::Unrestricted };
 
     /** Access Nodes */
-    std::set<std::string> accessNodes {};
+    ArenaSet<Symbol> accessNodes {};
 
     /** Value Descriptions (VAL) */
     ValueDescriptions valueDescriptions {};
@@ -108,7 +112,7 @@ struct VECTOR_DBC_EXPORT EnvironmentVariable {
     std::string comment {};
 
     /** Attribute Values (BA) */
-    std::map<std::string, Attribute> attributeValues {};
+    ArenaMap<Symbol, Attribute> attributeValues {};
 };
 
 std::ostream & operator<<(std::ostream & os, const EnvironmentVariable & environmentVariable);
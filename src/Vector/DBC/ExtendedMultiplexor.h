@@ -28,6 +28,8 @@
 #include <string>
 #include <utility>
 
+#include <Vector/DBC/Arena.h>
+
 #include <Vector/DBC/vector_dbc_export.h>
 
 namespace Vector {
@@ -35,6 +37,8 @@ namespace DBC {
 
 /**
  * Extended Multiplexor (SG_MUL_VAL)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT ExtendedMultiplexor {
     /** Switch Name */
@@ -44,7 +48,7 @@ struct VECTOR_DBC_EXPORT ExtendedMultiplexor {
     using ValueRange = std::pair<uint32_t, uint32_t>;
 
     /** Value Range */
-    std::set<ValueRange> valueRanges {};
+    ArenaSet<ValueRange> valueRanges {};
 };
 
 }
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/FlatNetwork.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace DBC {
+
+FlatNetwork::FlatNetwork(const Network & network) {
+    std::size_t signalCount = 0;
+    for (const auto & message : network.messages)
+        signalCount += message.second.signals.size();
+    messageList.reserve(network.messages.size());
+    signalList.reserve(signalCount);
+    signalKeys.reserve(signalCount);
+    compiledSignalList.reserve(signalCount);
+
+    /* maps already iterate in identifier and name order */
+    for (const auto & message : network.messages) {
+        FlatMessage flatMessage;
+        flatMessage.key = message.first;
+        flatMessage.id = message.second.id;
+        flatMessage.name = message.second.name;
+        flatMessage.size = message.second.size;
+        flatMessage.transmitter = message.second.transmitter;
+        flatMessage.firstSignal = static_cast<uint32_t>(signalList.size());
+        flatMessage.signalCount = static_cast<uint32_t>(message.second.signals.size());
+        flatMessage.transmitters = message.second.transmitters;
+        flatMessage.signalGroups = message.second.signalGroups;
+        flatMessage.comment = message.second.comment;
+        flatMessage.attributeValues = message.second.attributeValues;
+        messageList.push_back(std::move(flatMessage));
+        for (const auto & signal : message.second.signals) {
+            signalList.push_back(signal.second);
+            signalKeys.push_back(signal.first);
+            compiledSignalList.emplace_back(signal.second);
+        }
+    }
+
+    /* name index */
+    messageNames.resize(messageList.size());
+    for (uint32_t position = 0; position < messageNames.size(); ++position)
+        messageNames[position] = position;
+    std::stable_sort(messageNames.begin(), messageNames.end(), [this](uint32_t lhs, uint32_t rhs) {
+        return messageList[lhs].name < messageList[rhs].name;
+    });
+}
+
+const FlatMessage * FlatNetwork::findMessage(uint32_t id) const {
+    auto it = std::lower_bound(messageList.begin(), messageList.end(), id, [](const FlatMessage & lhs, uint32_t rhs) {
+        return lhs.key < rhs;
+    });
+    if ((it == messageList.end()) || (it->key != id))
+        return nullptr;
+    return &*it;
+}
+
+const FlatMessage * FlatNetwork::findMessage(const std::string & name) const {
+    auto it = std::lower_bound(messageNames.begin(), messageNames.end(), name, [this](uint32_t lhs, const std::string & rhs) {
+        return messageList[lhs].name < rhs;
+    });
+    if ((it == messageNames.end()) || (messageList[*it].name != name))
+        return nullptr;
+    return &messageList[*it];
+}
+
+const Signal * FlatNetwork::findSignal(const FlatMessage & message, const std::string & name) const {
+    /* keys of the message's signals are sorted */
+    auto begin = signalKeys.begin() + message.firstSignal;
+    auto end = begin + message.signalCount;
+    auto it = std::lower_bound(begin, end, name);
+    if ((it == end) || (*it != name))
+        return nullptr;
+    return &signalList[static_cast<std::size_t>(it - signalKeys.begin())];
+}
+
+}
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC/Arena.h>
+#include <Vector/DBC/Attribute.h>
+#include <Vector/DBC/CompiledSignal.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/Signal.h>
+#include <Vector/DBC/SignalGroup.h>
+#include <Vector/DBC/Span.h>
+#include <Vector/DBC/Symbol.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message in a FlatNetwork
+ *
+ * Same fields as Message, except that the signals are a range of
+ * FlatNetwork::signals.
+ */
+struct VECTOR_DBC_EXPORT FlatMessage {
+    /** Key in Network::messages, which is the identifier also for messages only referenced e.g. by CM_ */
+    uint32_t key {};
+
+    /** @copydoc Message::id */
+    uint32_t id {};
+
+    /** @copydoc Message::name */
+    std::string name {};
+
+    /** @copydoc Message::size */
+    uint32_t size {};
+
+    /** @copydoc Message::transmitter */
+    Symbol transmitter {};
+
+    /** Position of first signal in FlatNetwork::signals */
+    uint32_t firstSignal {};
+
+    /** Number of signals */
+    uint32_t signalCount {};
+
+    /** @copydoc Message::transmitters */
+    ArenaSet<Symbol> transmitters {};
+
+    /** @copydoc Message::signalGroups */
+    ArenaMap<std::string, SignalGroup> signalGroups {};
+
+    /** @copydoc Message::comment */
+    std::string comment {};
+
+    /** @copydoc Message::attributeValues */
+    ArenaMap<Symbol, Attribute> attributeValues {};
+};
+
+/**
+ * Flat Network
+ *
+ * Frozen copy of the messages and signals of a network in two arrays.
+ * Messages are sorted by their key in Network::messages. The signals of
+ * all messages are stored one after another in message order, and sorted
+ * by their key in Message::signals within their message. So iterating
+ * over all signals of all messages reads memory sequentially, instead of
+ * following the nodes of nested maps.
+ *
+ * Messages are found by identifier or name, and signals by name, with
+ * binary search.
+ *
+ * The fields needed for decoding are additionally kept as compiled
+ * signals in an own array, with the same order as the signals. A
+ * compiled signal has 48 bytes, so the decode data of a large database
+ * fits into the cache, while the remaining fields like unit, receivers,
+ * comment and attributes are only read from the signal when needed.
+ *
+ * The flat network is a copy, so it stays valid when the network is
+ * changed or destroyed. Changes of the network are not reflected.
+ */
+class VECTOR_DBC_EXPORT FlatNetwork {
+  public:
+    FlatNetwork() = default;
+
+    /**
+     * @brief Copy messages and signals of network
+     * @param[in] network Network
+     */
+    explicit FlatNetwork(const Network & network);
+
+    /**
+     * @brief Get messages
+     * @return Messages (sorted by key)
+     */
+    Span<const FlatMessage> messages() const {
+        return messageList;
+    }
+
+    /**
+     * @brief Get signals of all messages
+     * @return Signals (in message order, sorted by key within message)
+     */
+    Span<const Signal> signals() const {
+        return signalList;
+    }
+
+    /**
+     * @brief Get signals of message
+     * @param[in] message Message of this flat network
+     * @return Signals (sorted by key)
+     */
+    Span<const Signal> signals(const FlatMessage & message) const {
+        return Span<const Signal>(signalList.data() + message.firstSignal, message.signalCount);
+    }
+
+    /**
+     * @brief Get compiled signals of all messages
+     * @return Compiled signals (same order as signals)
+     */
+    Span<const CompiledSignal> compiledSignals() const {
+        return compiledSignalList;
+    }
+
+    /**
+     * @brief Get compiled signals of message
+     * @param[in] message Message of this flat network
+     * @return Compiled signals (same order as signals of message)
+     */
+    Span<const CompiledSignal> compiledSignals(const FlatMessage & message) const {
+        return Span<const CompiledSignal>(compiledSignalList.data() + message.firstSignal, message.signalCount);
+    }
+
+    /**
+     * @brief Get signal of compiled signal
+     * @param[in] compiledSignal Compiled signal of this flat network
+     * @return Signal
+     */
+    const Signal & signal(const CompiledSignal & compiledSignal) const {
+        return signalList[static_cast<std::size_t>(&compiledSignal - compiledSignalList.data())];
+    }
+
+    /**
+     * @brief Find message by identifier
+     * @param[in] id Message Identifier (key in Network::messages, bit 31 set for extended frames)
+     * @return Message (nullptr if message is unknown)
+     */
+    const FlatMessage * findMessage(uint32_t id) const;
+
+    /**
+     * @brief Find message by name
+     * @param[in] name Message name
+     * @return Message (nullptr if message is unknown)
+     */
+    const FlatMessage * findMessage(const std::string & name) const;
+
+    /**
+     * @brief Find signal of message by name
+     * @param[in] message Message of this flat network
+     * @param[in] name Signal name (key in Message::signals)
+     * @return Signal (nullptr if signal is unknown)
+     */
+    const Signal * findSignal(const FlatMessage & message, const std::string & name) const;
+
+  private:
+    /** messages (sorted by key) */
+    std::vector<FlatMessage> messageList {};
+
+    /** signals (in message order, sorted by key within message) */
+    std::vector<Signal> signalList {};
+
+    /** keys of signals in Message::signals (same order as signalList) */
+    std::vector<std::string> signalKeys {};
+
+    /** compiled signals (same order as signalList) */
+    std::vector<CompiledSignal> compiledSignalList {};
+
+    /** positions in messageList (sorted by message name) */
+    std::vector<uint32_t> messageNames {};
+};
+
+}
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Frame Record
+ *
+ * A received or recorded frame, as input for batch decoding.
+ */
+struct VECTOR_DBC_EXPORT FrameRecord {
+    /** Timestamp (unit is up to the application) */
+    uint64_t timestamp {};
+
+    /** Message Identifier (bit 31 set for extended frames) */
+    uint32_t id {};
+
+    /** Data Length Code */
+    uint8_t dlc {};
+
+    /** CAN FD Frame */
+    bool canFd {};
+
+    /** Data (dlcToDataSize(dlc, canFd) many bytes) */
+    const uint8_t * data {};
+};
+
+/**
+ * @brief Get data size from data length code
+ * @param[in] dlc Data Length Code (0..15)
+ * @param[in] canFd CAN FD Frame
+ * @return Data Size
+ *
+ * Classic CAN frames carry at most 8 bytes, CAN FD frames up to 64 bytes.
+ */
+inline std::size_t dlcToDataSize(uint8_t dlc, bool canFd) {
+    static const uint8_t canFdDataSizes[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+    if (dlc > 15)
+        dlc = 15;
+    if (!canFd && (dlc > 8))
+        return 8;
+    return canFdDataSizes[dlc];
+}
+
+/**
+ * @brief Get data length code from data size
+ * @param[in] dataSize Data Size (0..64)
+ * @return Data Length Code of the smallest frame, which fits the data
+ */
+inline uint8_t dataSizeToDlc(std::size_t dataSize) {
+    if (dataSize <= 8)
+        return static_cast<uint8_t>(dataSize);
+    if (dataSize <= 24)
+        return static_cast<uint8_t>(8 + (dataSize - 5) / 4);
+    if (dataSize <= 32)
+        return 13;
+    if (dataSize <= 48)
+        return 14;
+    return 15;
+}
+
+}
+}
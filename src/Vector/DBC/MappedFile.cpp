@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MappedFile.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Vector {
+namespace DBC {
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string & fileName) {
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return;
+    }
+
+    /* empty files can't be mapped */
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        opened = true;
+        return;
+    }
+
+    /* the view keeps the mapping alive, so the handles can be closed */
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return;
+    const void * view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+        return;
+
+    mappedData = static_cast<const char *>(view);
+    mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+    if (mappedData != nullptr)
+        UnmapViewOfFile(mappedData);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string & fileName) {
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat fileStatus;
+    if ((fstat(fd, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode)) {
+        close(fd);
+        return;
+    }
+
+    /* empty files can't be mapped */
+    if (fileStatus.st_size == 0) {
+        close(fd);
+        opened = true;
+        return;
+    }
+
+    /* the mapping stays valid after closing the file */
+    const std::size_t size = static_cast<std::size_t>(fileStatus.st_size);
+    void * address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+        return;
+    madvise(address, size, MADV_SEQUENTIAL);
+
+    mappedData = static_cast<const char *>(address);
+    mappedSize = size;
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+    if (mappedData != nullptr)
+        munmap(const_cast<char *>(mappedData), mappedSize);
+}
+
+#endif
+
+}
+}
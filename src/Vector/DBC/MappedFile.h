@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <string>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Mapped File
+ *
+ * Read-only memory mapping of a complete file (mmap on POSIX systems,
+ * MapViewOfFile on Windows). The mapping is released on destruction.
+ */
+class VECTOR_DBC_EXPORT MappedFile {
+  public:
+    /**
+     * @brief Map file
+     * @param[in] fileName File name
+     */
+    explicit MappedFile(const std::string & fileName);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Check if the file was opened and mapped
+     * @return true if file is mapped
+     */
+    bool isOpen() const {
+        return opened;
+    }
+
+    /**
+     * @brief Get mapped data
+     * @return Data (nullptr for empty files)
+     */
+    const char * data() const {
+        return mappedData;
+    }
+
+    /**
+     * @brief Get size of mapped data
+     * @return Size in bytes
+     */
+    std::size_t size() const {
+        return mappedSize;
+    }
+
+  private:
+    /** mapped data */
+    const char * mappedData {};
+
+    /** size of mapped data */
+    std::size_t mappedSize {};
+
+    /** file was opened */
+    bool opened {};
+};
+
+}
+}
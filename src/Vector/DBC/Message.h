@@ -29,9 +29,11 @@
 #include <set>
 #include <string>
 
+#include <Vector/DBC/Arena.h>
 #include <Vector/DBC/Attribute.h>
 #include <Vector/DBC/Signal.h>
 #include <Vector/DBC/SignalGroup.h>
+#include <Vector/DBC/Symbol.h>
 
 #include <Vector/DBC/vector_dbc_export.h>
 
@@ -40,6 +42,8 @@ namespace DBC {
 
 /**
  * Message (BO)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT Message {
     /** Identifier (with bit 31 set this is extended CAN frame) */
@@ -52,22 +56,22 @@ struct VECTOR_DBC_EXPORT Message {
     uint32_t size {};
 
     /** Transmitter (empty string if the number of send nodes is zero or more than one) */
-    std::string transmitter {};
+    Symbol transmitter {};
 
     /** Signals (SG) */
-    std::map<std::string, Signal> signals {};
+    ArenaMap<std::string, Signal> signals {};
 
     /** Message Transmitters (BO_TX_BU) */
-    std::set<std::string> transmitters {};
+    ArenaSet<Symbol> transmitters {};
 
     /** Signal Groups (SIG_GROUP) */
-    std::map<std::string, SignalGroup> signalGroups {};
+    ArenaMap<std::string, SignalGroup> signalGroups {};
 
     /** Comment (CM) */
     std::string comment {};
 
     /** Attribute Values (BA) */
-    std::map<std::string, Attribute> attributeValues {};
+    ArenaMap<Symbol, Attribute> attributeValues {};
 };
 
 std::ostream & operator<<(std::ostream & os, const Message & message);
@@ -0,0 +1,476 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <Vector/DBC/ColumnDecoder.h>
+#include <Vector/DBC/MessageDecoder.h>
+
+namespace Vector {
+namespace DBC {
+
+constexpr std::size_t MessageDecoder::maximumPaddedSize;
+constexpr uint32_t MessageDecoder::noMultiplexor;
+constexpr uint32_t MessageDecoder::unknownMessage;
+
+/**
+ * @brief Zero pad data of a fixed size
+ * @param[in] dataSize Data Size needed by the signals
+ * @param[in] data Data (Size many bytes)
+ * @param[out] buffer Buffer (maximumPaddedSize many bytes)
+ * @return Data or Buffer (nullptr if dataSize exceeds maximumPaddedSize)
+ */
+template<std::size_t Size>
+static const uint8_t * padFixedData(std::size_t dataSize, const uint8_t * data, uint8_t * buffer) {
+    if (dataSize <= Size)
+        return data;
+    if (dataSize > MessageDecoder::maximumPaddedSize)
+        return nullptr;
+    std::memcpy(buffer, data, Size);
+    std::memset(buffer + Size, 0, MessageDecoder::maximumPaddedSize - Size);
+    return buffer;
+}
+
+/**
+ * @brief Zero pad data
+ * @param[in] dataSize Data Size needed by the signals
+ * @param[in] data Data
+ * @param[in] size Data Size
+ * @param[out] buffer Buffer (maximumPaddedSize many bytes)
+ * @return Data or Buffer (nullptr if dataSize exceeds maximumPaddedSize)
+ *
+ * Classic CAN (8 bytes) and common CAN FD frame sizes (32, 64 bytes)
+ * use fixed size copies.
+ */
+static const uint8_t * padData(std::size_t dataSize, const uint8_t * data, std::size_t size, uint8_t * buffer) {
+    switch (size) {
+    case 8:
+        return padFixedData<8>(dataSize, data, buffer);
+    case 32:
+        return padFixedData<32>(dataSize, data, buffer);
+    case 64:
+        return padFixedData<64>(dataSize, data, buffer);
+    default:
+        break;
+    }
+    if (dataSize <= size)
+        return data;
+    if (dataSize > MessageDecoder::maximumPaddedSize)
+        return nullptr;
+    std::memset(buffer, 0, MessageDecoder::maximumPaddedSize);
+    std::memcpy(buffer, data, size);
+    return buffer;
+}
+
+/** Maximum switch value, up to which a direct range table is used */
+static const uint32_t maximumRangeTableSwitchValue = 1023;
+
+MessageDecoder::MessageDecoder(const Network & network) :
+    messageIndex(network, false, MessageIndex::Content::Positions),
+    labelPool(std::make_shared<StringPool>()) {
+    /* std::map is sorted by identifier, so messages are as well */
+    for (const auto & message : network.messages) {
+        MessageEntry messageEntry;
+        messageEntry.id = message.second.id;
+        messageEntry.firstSignal = static_cast<uint32_t>(signals.size());
+        messageEntry.signalCount = static_cast<uint32_t>(message.second.signals.size());
+        messageEntry.dataSize = 0;
+
+        /* compile signals */
+        std::map<std::string, uint32_t> indexByName;
+        uint32_t messageSwitch = noMultiplexor;
+        uint32_t index = 0;
+        for (const auto & signal : message.second.signals) {
+            signals.emplace_back(signal.second);
+            signalNames.push_back(signal.second.name);
+            valueDescriptionTables.emplace_back(signal.second.valueDescriptions, labelPool);
+            signalSwitches.push_back(noMultiplexor);
+            messageEntry.dataSize = std::max<uint32_t>(messageEntry.dataSize, signals.back().dataSize);
+            indexByName[signal.second.name] = index;
+            if ((signal.second.multiplexor == Signal::Multiplexor::MultiplexorSwitch) && (messageSwitch == noMultiplexor))
+                messageSwitch = index;
+            ++index;
+        }
+
+        /* build dependency tree from switch to multiplexed signals */
+        std::map<uint32_t, std::vector<std::pair<uint32_t, std::set<ExtendedMultiplexor::ValueRange>>>> children;
+        std::vector<uint32_t> staticSignals;
+        index = 0;
+        for (const auto & signal : message.second.signals) {
+            uint32_t parent = noMultiplexor;
+            std::set<ExtendedMultiplexor::ValueRange> valueRanges;
+            if (!signal.second.extendedMultiplexors.empty()) {
+                /* a multiplexed signal depends on a single switch */
+                const ExtendedMultiplexor & extendedMultiplexor = signal.second.extendedMultiplexors.begin()->second;
+                auto it = indexByName.find(extendedMultiplexor.switchName);
+                if (it != indexByName.end()) {
+                    parent = it->second;
+                    valueRanges.insert(extendedMultiplexor.valueRanges.begin(), extendedMultiplexor.valueRanges.end());
+                }
+            } else
+            if ((signal.second.multiplexor == Signal::Multiplexor::MultiplexedSignal) && (messageSwitch != noMultiplexor)) {
+                parent = messageSwitch;
+                valueRanges.insert(std::make_pair(signal.second.multiplexerSwitchValue, signal.second.multiplexerSwitchValue));
+            }
+
+            /* without switch, multiplexed signals can't be selected, so they are always decoded */
+            if (parent == noMultiplexor)
+                staticSignals.push_back(index);
+            else
+                children[parent].emplace_back(index, valueRanges);
+            ++index;
+        }
+
+        /* compile switches into range lookup structures */
+        for (const auto & child : children) {
+            signalSwitches[messageEntry.firstSignal + child.first] = static_cast<uint32_t>(multiplexorSwitches.size());
+            multiplexorSwitches.push_back(compileSwitch(child.second));
+        }
+
+        /* always active signals, switches first */
+        std::stable_partition(staticSignals.begin(), staticSignals.end(), [&](uint32_t signalIndex) {
+            return children.count(signalIndex) != 0;
+        });
+        messageEntry.firstStaticSignalIndex = static_cast<uint32_t>(signalIndices.size());
+        messageEntry.staticSignalCount = static_cast<uint32_t>(staticSignals.size());
+        signalIndices.insert(signalIndices.end(), staticSignals.begin(), staticSignals.end());
+
+        messages.push_back(messageEntry);
+    }
+}
+
+std::size_t MessageDecoder::signalCount(uint32_t id) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return 0;
+
+    return messageEntry->signalCount;
+}
+
+int MessageDecoder::signalIndex(uint32_t id, const std::string & signalName) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return -1;
+
+    for (uint32_t i = 0; i < messageEntry->signalCount; ++i) {
+        if (signalNames[messageEntry->firstSignal + i] == signalName)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool MessageDecoder::decode(uint32_t id, const uint8_t * data, std::size_t size, SignalValue * values) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return false;
+
+    /* check bounds once and zero pad short data */
+    uint8_t buffer[maximumPaddedSize];
+    data = padData(messageEntry->dataSize, data, size, buffer);
+    if (data == nullptr)
+        return false;
+
+    /* decode all signals */
+    const CompiledSignal * signal = signals.data() + messageEntry->firstSignal;
+    for (uint32_t i = 0; i < messageEntry->signalCount; ++i) {
+        values[i].rawValue = signal[i].decode(data);
+        values[i].physicalValue = signal[i].rawToPhysicalValue(values[i].rawValue);
+    }
+
+    return true;
+}
+
+bool MessageDecoder::decodeLabels(uint32_t id, const uint8_t * data, std::size_t size, StringView * labels) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return false;
+
+    /* check bounds once and zero pad short data */
+    uint8_t buffer[maximumPaddedSize];
+    data = padData(messageEntry->dataSize, data, size, buffer);
+    if (data == nullptr)
+        return false;
+
+    /* decode only signals with value descriptions */
+    const CompiledSignal * signal = signals.data() + messageEntry->firstSignal;
+    const ValueDescriptionTable * valueDescriptionTable = valueDescriptionTables.data() + messageEntry->firstSignal;
+    for (uint32_t i = 0; i < messageEntry->signalCount; ++i) {
+        if (valueDescriptionTable[i].empty())
+            labels[i] = StringView();
+        else
+            labels[i] = valueDescriptionTable[i].find(signal[i].decode(data));
+    }
+
+    return true;
+}
+
+const ValueDescriptionTable & MessageDecoder::valueDescriptionTable(uint32_t id, std::size_t index) const {
+    static const ValueDescriptionTable emptyTable;
+
+    const MessageEntry * messageEntry = find(id);
+    if ((messageEntry == nullptr) || (index >= messageEntry->signalCount))
+        return emptyTable;
+
+    return valueDescriptionTables[messageEntry->firstSignal + index];
+}
+
+std::size_t MessageDecoder::decodeActive(uint32_t id, const uint8_t * data, std::size_t size, SignalValue * values, uint32_t * indices) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return 0;
+
+    /* check bounds once and zero pad short data */
+    uint8_t buffer[maximumPaddedSize];
+    data = padData(messageEntry->dataSize, data, size, buffer);
+    if (data == nullptr)
+        return 0;
+
+    return decodeActive(*messageEntry, data, values, indices);
+}
+
+std::size_t MessageDecoder::columnCount() const {
+    return signals.size();
+}
+
+int MessageDecoder::columnIndex(uint32_t id, const std::string & signalName) const {
+    const MessageEntry * messageEntry = find(id);
+    if (messageEntry == nullptr)
+        return -1;
+
+    const int index = signalIndex(id, signalName);
+    if (index < 0)
+        return -1;
+
+    return static_cast<int>(messageEntry->firstSignal) + index;
+}
+
+std::size_t MessageDecoder::decodeBatch(const FrameRecord * frames, std::size_t frameCount, std::vector<SignalColumn> & columns) const {
+    if (columns.size() < signals.size())
+        columns.resize(signals.size());
+
+    /* group frames by message with a counting sort, which keeps the frame order */
+    std::vector<uint32_t> positions(frameCount);
+    std::vector<std::size_t> groupBegin(messages.size() + 1, 0);
+    for (std::size_t i = 0; i < frameCount; ++i) {
+        const int position = messageIndex.position(frames[i].id);
+        positions[i] = (position < 0) ? unknownMessage : static_cast<uint32_t>(position);
+        if (position >= 0)
+            ++groupBegin[position + 1];
+    }
+    for (std::size_t m = 0; m < messages.size(); ++m)
+        groupBegin[m + 1] += groupBegin[m];
+    std::vector<std::size_t> groupEnd(groupBegin.begin(), groupBegin.end() - 1);
+    std::vector<uint32_t> order(groupBegin.back());
+    for (std::size_t i = 0; i < frameCount; ++i) {
+        if (positions[i] != unknownMessage)
+            order[groupEnd[positions[i]]++] = static_cast<uint32_t>(i);
+    }
+
+    /* decode message by message */
+    std::vector<uint8_t> staging;
+    std::vector<SignalValue> values;
+    std::vector<uint32_t> indices;
+    for (std::size_t m = 0; m < messages.size(); ++m) {
+        const MessageEntry & messageEntry = messages[m];
+        const uint32_t * frameIndex = order.data() + groupBegin[m];
+        const std::size_t count = groupBegin[m + 1] - groupBegin[m];
+        if ((count == 0) || (messageEntry.signalCount == 0))
+            continue;
+
+        /* copy payloads into zero padded, strided staging buffer */
+        const std::size_t stride = messageEntry.dataSize;
+        staging.assign(count * stride, 0);
+        for (std::size_t k = 0; k < count; ++k) {
+            const FrameRecord & frame = frames[frameIndex[k]];
+            const std::size_t size = std::min(dlcToDataSize(frame.dlc, frame.canFd), stride);
+            if (size != 0)
+                std::memcpy(&staging[k * stride], frame.data, size);
+        }
+
+        if (messageEntry.staticSignalCount == messageEntry.signalCount) {
+            /* apply each signal to the run of payloads */
+            for (uint32_t s = 0; s < messageEntry.signalCount; ++s) {
+                const CompiledSignal & signal = signals[messageEntry.firstSignal + s];
+                SignalColumn & column = columns[messageEntry.firstSignal + s];
+                const std::size_t offset = column.values.size();
+                column.timestamps.resize(offset + count);
+                column.values.resize(offset + count);
+                uint64_t * timestamp = &column.timestamps[offset];
+                for (std::size_t k = 0; k < count; ++k)
+                    timestamp[k] = frames[frameIndex[k]].timestamp;
+                ColumnDecoder::decode(signal, staging.data(), stride, count, &column.values[offset]);
+            }
+        } else {
+            /* multiplexed signals are only appended, if they are active */
+            values.resize(messageEntry.signalCount);
+            indices.resize(messageEntry.signalCount);
+            for (std::size_t k = 0; k < count; ++k) {
+                const std::size_t activeCount = decodeActive(messageEntry, &staging[k * stride], values.data(), indices.data());
+                for (std::size_t i = 0; i < activeCount; ++i) {
+                    SignalColumn & column = columns[messageEntry.firstSignal + indices[i]];
+                    column.timestamps.push_back(frames[frameIndex[k]].timestamp);
+                    column.values.push_back(values[indices[i]].physicalValue);
+                }
+            }
+        }
+    }
+
+    return order.size();
+}
+
+std::size_t MessageDecoder::decodeActive(const MessageEntry & messageEntry, const uint8_t * data, SignalValue * values, uint32_t * indices) const {
+    /* decode always active signals, starting with the multiplexor switches */
+    const CompiledSignal * signal = signals.data() + messageEntry.firstSignal;
+    const uint32_t * signalSwitch = signalSwitches.data() + messageEntry.firstSignal;
+    std::size_t count = 0;
+    const uint32_t * signalIndex = signalIndices.data() + messageEntry.firstStaticSignalIndex;
+    for (uint32_t i = 0; i < messageEntry.staticSignalCount; ++i) {
+        const uint32_t index = signalIndex[i];
+        values[index].rawValue = signal[index].decode(data);
+        values[index].physicalValue = signal[index].rawToPhysicalValue(values[index].rawValue);
+        indices[count++] = index;
+    }
+
+    /* walk down the switch chain, decoded signals serve as work list */
+    for (std::size_t position = 0; position < count; ++position) {
+        const uint32_t switchIndex = indices[position];
+        if (signalSwitch[switchIndex] == noMultiplexor)
+            continue;
+        const MultiplexorRange * multiplexorRange = findRange(multiplexorSwitches[signalSwitch[switchIndex]], values[switchIndex].rawValue);
+        if (multiplexorRange == nullptr)
+            continue;
+        signalIndex = signalIndices.data() + multiplexorRange->firstSignalIndex;
+        for (uint32_t i = 0; i < multiplexorRange->signalCount; ++i) {
+            const uint32_t index = signalIndex[i];
+            values[index].rawValue = signal[index].decode(data);
+            values[index].physicalValue = signal[index].rawToPhysicalValue(values[index].rawValue);
+            indices[count++] = index;
+        }
+    }
+
+    return count;
+}
+
+const MessageDecoder::MessageEntry * MessageDecoder::find(uint32_t id) const {
+    const int position = messageIndex.position(id);
+    if (position < 0)
+        return nullptr;
+
+    return &messages[position];
+}
+
+const MessageDecoder::MultiplexorRange * MessageDecoder::findRange(const MultiplexorSwitch & multiplexorSwitch, uint64_t switchValue) const {
+    /* direct range table */
+    if (multiplexorSwitch.rangeTableSize != 0) {
+        if (switchValue >= multiplexorSwitch.rangeTableSize)
+            return nullptr;
+        const uint32_t range = rangeTable[multiplexorSwitch.firstRangeTableEntry + switchValue];
+        if (range == noMultiplexor)
+            return nullptr;
+        return &multiplexorRanges[range];
+    }
+
+    /* binary search on sorted, disjoint ranges */
+    auto first = multiplexorRanges.begin() + multiplexorSwitch.firstRange;
+    auto last = first + multiplexorSwitch.rangeCount;
+    auto it = std::upper_bound(first, last, switchValue, [](uint64_t switchValue, const MultiplexorRange & multiplexorRange) {
+        return switchValue < multiplexorRange.minimum;
+    });
+    if (it == first)
+        return nullptr;
+    --it;
+    if (switchValue > it->maximum)
+        return nullptr;
+
+    return &*it;
+}
+
+MessageDecoder::MultiplexorSwitch MessageDecoder::compileSwitch(const std::vector<std::pair<uint32_t, std::set<ExtendedMultiplexor::ValueRange>>> & children) {
+    /* split value ranges into elementary intervals */
+    std::vector<uint64_t> bounds;
+    for (const auto & child : children) {
+        for (const auto & valueRange : child.second) {
+            if (valueRange.first <= valueRange.second) {
+                bounds.push_back(valueRange.first);
+                bounds.push_back(static_cast<uint64_t>(valueRange.second) + 1);
+            }
+        }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    /* assign signals to intervals and merge adjacent intervals with the same signals */
+    MultiplexorSwitch multiplexorSwitch;
+    multiplexorSwitch.firstRange = static_cast<uint32_t>(multiplexorRanges.size());
+    multiplexorSwitch.rangeCount = 0;
+    std::vector<uint32_t> activeSignals;
+    for (std::size_t i = 0; i + 1 < bounds.size(); ++i) {
+        const uint32_t minimum = static_cast<uint32_t>(bounds[i]);
+        const uint32_t maximum = static_cast<uint32_t>(bounds[i + 1] - 1);
+        activeSignals.clear();
+        for (const auto & child : children) {
+            for (const auto & valueRange : child.second) {
+                if ((valueRange.first <= minimum) && (maximum <= valueRange.second)) {
+                    activeSignals.push_back(child.first);
+                    break;
+                }
+            }
+        }
+        if (activeSignals.empty())
+            continue;
+        if (multiplexorSwitch.rangeCount != 0) {
+            MultiplexorRange & previousRange = multiplexorRanges.back();
+            if ((static_cast<uint64_t>(previousRange.maximum) + 1 == minimum) &&
+                    (previousRange.signalCount == activeSignals.size()) &&
+                    std::equal(activeSignals.begin(), activeSignals.end(), signalIndices.begin() + previousRange.firstSignalIndex)) {
+                previousRange.maximum = maximum;
+                continue;
+            }
+        }
+        MultiplexorRange multiplexorRange;
+        multiplexorRange.minimum = minimum;
+        multiplexorRange.maximum = maximum;
+        multiplexorRange.firstSignalIndex = static_cast<uint32_t>(signalIndices.size());
+        multiplexorRange.signalCount = static_cast<uint32_t>(activeSignals.size());
+        signalIndices.insert(signalIndices.end(), activeSignals.begin(), activeSignals.end());
+        multiplexorRanges.push_back(multiplexorRange);
+        ++multiplexorSwitch.rangeCount;
+    }
+
+    /* direct range table for small switch values */
+    multiplexorSwitch.firstRangeTableEntry = static_cast<uint32_t>(rangeTable.size());
+    multiplexorSwitch.rangeTableSize = 0;
+    if ((multiplexorSwitch.rangeCount != 0) && (multiplexorRanges.back().maximum <= maximumRangeTableSwitchValue)) {
+        multiplexorSwitch.rangeTableSize = multiplexorRanges.back().maximum + 1;
+        rangeTable.resize(rangeTable.size() + multiplexorSwitch.rangeTableSize, noMultiplexor);
+        for (uint32_t range = multiplexorSwitch.firstRange; range < multiplexorSwitch.firstRange + multiplexorSwitch.rangeCount; ++range) {
+            for (uint32_t switchValue = multiplexorRanges[range].minimum; switchValue <= multiplexorRanges[range].maximum; ++switchValue)
+                rangeTable[multiplexorSwitch.firstRangeTableEntry + switchValue] = range;
+        }
+    }
+
+    return multiplexorSwitch;
+}
+
+}
+}
@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Vector/DBC/CompiledSignal.h>
+#include <Vector/DBC/ExtendedMultiplexor.h>
+#include <Vector/DBC/FrameRecord.h>
+#include <Vector/DBC/MessageIndex.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/Span.h>
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/ValueDescriptionTable.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Value
+ */
+struct VECTOR_DBC_EXPORT SignalValue {
+    /** Raw Value */
+    uint64_t rawValue {};
+
+    /** Physical Value */
+    double physicalValue {};
+};
+
+/**
+ * Signal Column
+ *
+ * Decoded values of one signal over many frames.
+ */
+struct VECTOR_DBC_EXPORT SignalColumn {
+    /** Timestamps */
+    std::vector<uint64_t> timestamps {};
+
+    /** Physical Values (same order as timestamps) */
+    std::vector<double> values {};
+};
+
+/**
+ * Message Decoder
+ *
+ * Decodes all signals of a message in one pass over a flat array of
+ * compiled signals. The decoder is built once from a network and
+ * doesn't refer to it afterwards.
+ */
+class VECTOR_DBC_EXPORT MessageDecoder {
+  public:
+    MessageDecoder() = default;
+
+    /**
+     * @brief Build decoder from network
+     * @param[in] network Network
+     */
+    explicit MessageDecoder(const Network & network);
+
+    /** Maximum data size, up to which short data is zero padded */
+    static constexpr std::size_t maximumPaddedSize = 64;
+
+    /**
+     * @brief Get number of signals of a message
+     * @param[in] id Message Identifier
+     * @return Number of signals (0 if message is unknown)
+     */
+    std::size_t signalCount(uint32_t id) const;
+
+    /**
+     * @brief Get the index of a signal within the decoded values
+     * @param[in] id Message Identifier
+     * @param[in] signalName Signal Name
+     * @return Signal Index (-1 if message or signal is unknown)
+     *
+     * Signals are decoded in the order of Message::signals.
+     */
+    int signalIndex(uint32_t id, const std::string & signalName) const;
+
+    /**
+     * @brief Decode all signals of a message
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[in] size Data Size
+     * @param[out] values Signal Values (signalCount many)
+     * @return true if message is known and data could be decoded
+     *
+     * Data shorter than needed by the signals is zero padded,
+     * if the message fits into maximumPaddedSize.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    bool decode(uint32_t id, const uint8_t * data, std::size_t size, SignalValue * values) const;
+
+    /**
+     * @brief Decode all signals of a message
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[out] values Signal Values (signalCount many)
+     * @return true if message is known and data could be decoded
+     */
+    bool decode(uint32_t id, Span<const uint8_t> data, SignalValue * values) const {
+        return decode(id, data.data(), data.size(), values);
+    }
+
+    /**
+     * @brief Decode all active signals of a message
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[in] size Data Size
+     * @param[out] values Signal Values (signalCount many)
+     * @param[out] indices Indices of the decoded signals (signalCount many)
+     * @return Number of decoded signals (0 if message is unknown or data could not be decoded)
+     *
+     * This decodes the multiplexor switches first and then only the
+     * multiplexed signals that are selected by the switch values.
+     * Extended multiplexing (SG_MUL_VAL_) is evaluated along the chain
+     * of nested switches, otherwise multiplexed signals depend on the
+     * multiplexor switch of the message.
+     * Values are written to the same positions as by decode. The
+     * positions written are listed in indices, parents before children.
+     */
+    std::size_t decodeActive(uint32_t id, const uint8_t * data, std::size_t size, SignalValue * values, uint32_t * indices) const;
+
+    /**
+     * @brief Decode all active signals of a message
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[out] values Signal Values (signalCount many)
+     * @param[out] indices Indices of the decoded signals (signalCount many)
+     * @return Number of decoded signals (0 if message is unknown or data could not be decoded)
+     */
+    std::size_t decodeActive(uint32_t id, Span<const uint8_t> data, SignalValue * values, uint32_t * indices) const {
+        return decodeActive(id, data.data(), data.size(), values, indices);
+    }
+
+    /**
+     * @brief Decode enum signals of a message to labels
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[in] size Data Size
+     * @param[out] labels Labels (signalCount many)
+     * @return true if message is known and data could be decoded
+     *
+     * Only signals with value descriptions (VAL_) are decoded. Their
+     * labels are views into the string pool of the decoder, which stay
+     * valid as long as the decoder. Signals without value descriptions
+     * or without description for their value get an empty label.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    bool decodeLabels(uint32_t id, const uint8_t * data, std::size_t size, StringView * labels) const;
+
+    /**
+     * @brief Decode enum signals of a message to labels
+     * @param[in] id Message Identifier
+     * @param[in] data Data
+     * @param[out] labels Labels (signalCount many)
+     * @return true if message is known and data could be decoded
+     */
+    bool decodeLabels(uint32_t id, Span<const uint8_t> data, StringView * labels) const {
+        return decodeLabels(id, data.data(), data.size(), labels);
+    }
+
+    /**
+     * @brief Get the value description table of a signal
+     * @param[in] id Message Identifier
+     * @param[in] index Signal Index
+     * @return Value Description Table (empty if message or signal is unknown)
+     */
+    const ValueDescriptionTable & valueDescriptionTable(uint32_t id, std::size_t index) const;
+
+    /**
+     * @brief Get number of signal columns
+     * @return Number of signals of all messages
+     */
+    std::size_t columnCount() const;
+
+    /**
+     * @brief Get the column of a signal
+     * @param[in] id Message Identifier
+     * @param[in] signalName Signal Name
+     * @return Column Index (-1 if message or signal is unknown)
+     */
+    int columnIndex(uint32_t id, const std::string & signalName) const;
+
+    /**
+     * @brief Decode a batch of frames into signal columns
+     * @param[in] frames Frame Records
+     * @param[in] frameCount Number of frames
+     * @param[in,out] columns Signal Columns (at least columnCount many)
+     * @return Number of decoded frames (frames of unknown messages are skipped)
+     *
+     * Frames are grouped by message, and each signal is decoded over the
+     * run of payloads of its message. Values are appended to the columns,
+     * in the order of the frames. Multiplexed signals only get values for
+     * frames in which they are active.
+     */
+    std::size_t decodeBatch(const FrameRecord * frames, std::size_t frameCount, std::vector<SignalColumn> & columns) const;
+
+  private:
+    /** Multiplexor Range */
+    struct MultiplexorRange {
+        /** Minimum Switch Value */
+        uint32_t minimum;
+
+        /** Maximum Switch Value */
+        uint32_t maximum;
+
+        /** Index of the first signal index in signalIndices */
+        uint32_t firstSignalIndex;
+
+        /** Number of signals */
+        uint32_t signalCount;
+    };
+
+    /** Multiplexor Switch */
+    struct MultiplexorSwitch {
+        /** Index of the first range in multiplexorRanges (sorted and disjoint) */
+        uint32_t firstRange;
+
+        /** Number of ranges */
+        uint32_t rangeCount;
+
+        /** Index of the first entry in rangeTable (direct table, if rangeTableSize is not 0) */
+        uint32_t firstRangeTableEntry;
+
+        /** Number of entries in rangeTable */
+        uint32_t rangeTableSize;
+    };
+
+    /** Message Entry */
+    struct MessageEntry {
+        /** Identifier */
+        uint32_t id;
+
+        /** Index of the first signal */
+        uint32_t firstSignal;
+
+        /** Number of signals */
+        uint32_t signalCount;
+
+        /** Minimum data size needed by the signals */
+        uint32_t dataSize;
+
+        /** Index of the first always active signal index in signalIndices, starting with the switches */
+        uint32_t firstStaticSignalIndex;
+
+        /** Number of always active signals */
+        uint32_t staticSignalCount;
+    };
+
+    /** Marks signals that are no multiplexor switch and empty range table entries */
+    static constexpr uint32_t noMultiplexor = UINT32_MAX;
+
+    /** Marks frames of unknown messages in decodeBatch */
+    static constexpr uint32_t unknownMessage = UINT32_MAX;
+
+    /** Message Entries (sorted by identifier) */
+    std::vector<MessageEntry> messages {};
+
+    /** Message Index (only positions, so the network isn't referred to) */
+    MessageIndex messageIndex {};
+
+    /** Compiled Signals of all messages */
+    std::vector<CompiledSignal> signals {};
+
+    /** Signal Names (same order as signals) */
+    std::vector<std::string> signalNames {};
+
+    /** Value Description Tables (same order as signals) */
+    std::vector<ValueDescriptionTable> valueDescriptionTables {};
+
+    /** Labels of all value description tables */
+    std::shared_ptr<StringPool> labelPool {};
+
+    /** Multiplexor Switch of each signal (same order as signals, noMultiplexor if signal is no switch) */
+    std::vector<uint32_t> signalSwitches {};
+
+    /** Signal Indices of the always active signals and of the multiplexor ranges */
+    std::vector<uint32_t> signalIndices {};
+
+    /** Multiplexor Switches */
+    std::vector<MultiplexorSwitch> multiplexorSwitches {};
+
+    /** Multiplexor Ranges */
+    std::vector<MultiplexorRange> multiplexorRanges {};
+
+    /** Direct tables from switch value to range index */
+    std::vector<uint32_t> rangeTable {};
+
+    /**
+     * @brief Find message entry
+     * @param[in] id Message Identifier
+     * @return Message Entry (nullptr if message is unknown)
+     */
+    const MessageEntry * find(uint32_t id) const;
+
+    /**
+     * @brief Decode all active signals of a message
+     * @param[in] messageEntry Message Entry
+     * @param[in] data Data (at least dataSize many bytes)
+     * @param[out] values Signal Values
+     * @param[out] indices Indices of the decoded signals
+     * @return Number of decoded signals
+     */
+    std::size_t decodeActive(const MessageEntry & messageEntry, const uint8_t * data, SignalValue * values, uint32_t * indices) const;
+
+    /**
+     * @brief Find multiplexor range
+     * @param[in] multiplexorSwitch Multiplexor Switch
+     * @param[in] switchValue Switch Value
+     * @return Multiplexor Range (nullptr if no signal is multiplexed on this value)
+     */
+    const MultiplexorRange * findRange(const MultiplexorSwitch & multiplexorSwitch, uint64_t switchValue) const;
+
+    /**
+     * @brief Compile the ranges of a multiplexor switch
+     * @param[in] children Multiplexed Signals (index and value ranges)
+     * @return Multiplexor Switch
+     */
+    MultiplexorSwitch compileSwitch(const std::vector<std::pair<uint32_t, std::set<ExtendedMultiplexor::ValueRange>>> & children);
+};
+
+}
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/MessageIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+constexpr uint32_t MessageIndex::extendedFrame;
+constexpr uint32_t MessageIndex::standardIdCount;
+constexpr uint32_t MessageIndex::emptySlot;
+
+MessageIndex::MessageIndex(const Network & network, bool standardTable, Content content) :
+    messageCount(network.messages.size()) {
+    Slot slot;
+    slot.id = 0;
+    slot.position = emptySlot;
+    slot.message = nullptr;
+
+    /* standard identifiers go into the direct table */
+    std::size_t hashedCount = messageCount;
+    if (standardTable) {
+        standardSlots.assign(standardIdCount, slot);
+        hashedCount = 0;
+        for (const auto & message : network.messages) {
+            if (message.first >= standardIdCount)
+                ++hashedCount;
+        }
+    }
+
+    /* at most half of the slots are used, so probe sequences stay short */
+    uint32_t bits = 3;
+    while ((std::size_t(1) << bits) < 2 * hashedCount)
+        ++bits;
+    shift = 32 - bits;
+    slots.assign(std::size_t(1) << bits, slot);
+
+    /* insert messages */
+    const uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+    uint32_t position = 0;
+    for (const auto & message : network.messages) {
+        Slot * target;
+        if (!standardSlots.empty() && (message.first < standardIdCount))
+            target = &standardSlots[message.first];
+        else {
+            uint32_t index = hash(message.first);
+            while (slots[index].position != emptySlot)
+                index = (index + 1) & mask;
+            target = &slots[index];
+        }
+        target->id = message.first;
+        target->position = position;
+        target->message = (content == Content::Messages) ? &message.second : nullptr;
+        ++position;
+    }
+}
+
+const Message * MessageIndex::find(uint32_t id) const {
+    const Slot * slot = findSlot(id);
+    if (slot == nullptr)
+        return nullptr;
+
+    return slot->message;
+}
+
+int MessageIndex::position(uint32_t id) const {
+    const Slot * slot = findSlot(id);
+    if (slot == nullptr)
+        return -1;
+
+    return static_cast<int>(slot->position);
+}
+
+std::size_t MessageIndex::size() const {
+    return messageCount;
+}
+
+const MessageIndex::Slot * MessageIndex::findSlot(uint32_t id) const {
+    /* direct table */
+    if (!standardSlots.empty() && (id < standardIdCount)) {
+        const Slot & slot = standardSlots[id];
+        if (slot.position == emptySlot)
+            return nullptr;
+        return &slot;
+    }
+
+    if (slots.empty())
+        return nullptr;
+
+    /* linear probing until the identifier or an empty slot is found */
+    const uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+    uint32_t index = hash(id);
+    for (;;) {
+        const Slot & slot = slots[index];
+        if (slot.position == emptySlot)
+            return nullptr;
+        if (slot.id == id)
+            return &slot;
+        index = (index + 1) & mask;
+    }
+}
+
+}
+}
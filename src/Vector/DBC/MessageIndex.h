@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/Network.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Message Index
+ *
+ * Immutable, read-optimized index from message identifier to message.
+ * It's an open-addressing hash table with linear probing, which is
+ * at most half full. A slot holds identifier and message, so a lookup
+ * usually costs a single cache miss.
+ *
+ * As in Network::messages, bit 31 of the identifier marks extended frames.
+ *
+ * Optionally standard identifiers (0..0x7FF) are looked up in a direct
+ * table with one entry per identifier, so the lookup is a single indexed
+ * load. Only other identifiers then go through the hash table.
+ *
+ * The index refers to the messages of the network, so the network must
+ * not be changed or destroyed while the index is used. An index of only
+ * positions (Content::Positions) doesn't refer to the network, e.g. for
+ * owners, which outlive the network.
+ */
+class VECTOR_DBC_EXPORT MessageIndex {
+  public:
+    /** Content of the index */
+    enum class Content {
+        /** Positions and messages */
+        Messages,
+
+        /** Only positions, find always returns nullptr */
+        Positions
+    };
+
+    MessageIndex() = default;
+
+    /**
+     * @brief Build index from network
+     * @param[in] network Network
+     * @param[in] standardTable Use direct table for standard identifiers
+     * @param[in] content Content of the index
+     */
+    explicit MessageIndex(const Network & network, bool standardTable = false, Content content = Content::Messages);
+
+    /** Extended Frame Flag in message identifiers */
+    static constexpr uint32_t extendedFrame = 0x80000000;
+
+    /** Number of standard identifiers (11 bit) */
+    static constexpr uint32_t standardIdCount = 0x800;
+
+    /**
+     * @brief Find message
+     * @param[in] id Message Identifier (bit 31 set for extended frames)
+     * @return Message (nullptr if message is unknown or the index only has positions)
+     */
+    const Message * find(uint32_t id) const;
+
+    /**
+     * @brief Find message
+     * @param[in] canId CAN Identifier (11 or 29 bit)
+     * @param[in] extended Extended Frame
+     * @return Message (nullptr if message is unknown)
+     */
+    const Message * find(uint32_t canId, bool extended) const {
+        return find(extended ? (canId | extendedFrame) : canId);
+    }
+
+    /**
+     * @brief Get position of message in Network::messages
+     * @param[in] id Message Identifier (bit 31 set for extended frames)
+     * @return Position (-1 if message is unknown)
+     */
+    int position(uint32_t id) const;
+
+    /**
+     * @brief Get number of messages
+     * @return Number of messages
+     */
+    std::size_t size() const;
+
+  private:
+    /** Slot */
+    struct Slot {
+        /** Message Identifier */
+        uint32_t id;
+
+        /** Position in Network::messages (emptySlot if slot is empty) */
+        uint32_t position;
+
+        /** Message (nullptr if the index only has positions) */
+        const Message * message;
+    };
+
+    /** Marks empty slots */
+    static constexpr uint32_t emptySlot = UINT32_MAX;
+
+    /** Slots (power of two many) */
+    std::vector<Slot> slots {};
+
+    /** Direct table for standard identifiers (standardIdCount many, if used) */
+    std::vector<Slot> standardSlots {};
+
+    /** Shift to get the slot from the hash value */
+    uint32_t shift {};
+
+    /** Number of messages */
+    std::size_t messageCount {};
+
+    /**
+     * @brief Find slot
+     * @param[in] id Message Identifier
+     * @return Slot (nullptr if message is unknown)
+     */
+    const Slot * findSlot(uint32_t id) const;
+
+    /**
+     * @brief Hash function
+     * @param[in] id Message Identifier
+     * @return Slot Index
+     */
+    uint32_t hash(uint32_t id) const {
+        /* Fibonacci hashing, which spreads consecutive identifiers */
+        return static_cast<uint32_t>(id * UINT32_C(2654435769)) >> shift;
+    }
+};
+
+}
+}
@@ -21,471 +21,310 @@
 
 #include <Vector/DBC/Network.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <Vector/DBC/MappedFile.h>
+#include <Vector/DBC/NetworkWriter.h>
 #include <Vector/DBC/Parser.hpp>
 #include <Vector/DBC/Scanner.h>
 
 namespace Vector {
 namespace DBC {
 
-std::ostream & operator<<(std::ostream & os, const Network & network) {
-    /* use english decimal points for floating numbers */
-    os.imbue(std::locale("C"));
-
-    os.precision(16);
-
-    /* Version (VERSION) */
-    os << "VERSION \"" << network.version << "\"" << endl;
-    os << endl;
-
-    /* New Symbols (NS) */
-    os << endl;
-    os << "NS_ : " << endl;
-    for (const auto & newSymbol : network.newSymbols)
-        os << "\t" << newSymbol << endl;
-    os << endl;
-
-    /* Bit Timing (BS) */
-    os << network.bitTiming;
-    os << endl;
-
-    /* Nodes (BU) */
-    os << "BU_:";
-    if (network.nodes.empty())
-        os << " Vector__XXX";
+/**
+ * @brief Move container, or copy it if it allocates from another arena
+ * @param[out] lhs Target container
+ * @param[in] rhs Source container
+ *
+ * Moving the elements one by one into another arena would keep the
+ * arena of their own containers, so they are copied instead.
+ */
+template<typename Container>
+static void moveAssign(Container & lhs, Container & rhs) {
+    if (lhs.get_allocator() == rhs.get_allocator())
+        lhs = std::move(rhs);
     else
-        for (const auto & node : network.nodes)
-            os << " " << node.second.name;
-    os << endl;
-
-    /* Value Tables (VAL_TABLE) */
-    for (const auto & valueTable : network.valueTables)
-        os << valueTable.second;
-    os << endl;
-    os << endl;
-
-    /* Messages (BO) */
-    for (const auto & message : network.messages)
-        os << message.second;
-
-    /* Message Transmitters (BO_TX_BU) */
-    for (const auto & message : network.messages) {
-        if (!message.second.transmitters.empty()) {
-            os << "BO_TX_BU_ " << message.second.id << " :";
-            bool first = true;
-            for (const auto & transmitter : message.second.transmitters) {
-                if (first)
-                    first = false;
-                else
-                    os << ',';
-                os << transmitter;
-            }
-            os << ';' << endl;
-        }
-    }
-    os << endl;
+        lhs = rhs;
+}
 
-    /* Environment Variables (EV) */
-    for (const auto & environmentVariable : network.environmentVariables) {
-        os << endl;
-        os << environmentVariable.second;
-    }
+Network & Network::operator=(Network && other) {
+    successfullyParsed = other.successfullyParsed;
+    version = std::move(other.version);
+    moveAssign(newSymbols, other.newSymbols);
+    bitTiming = std::move(other.bitTiming);
+    moveAssign(nodes, other.nodes);
+    moveAssign(valueTables, other.valueTables);
+    moveAssign(messages, other.messages);
+    moveAssign(environmentVariables, other.environmentVariables);
+    moveAssign(signalTypes, other.signalTypes);
+    comment = std::move(other.comment);
+    moveAssign(attributeDefinitions, other.attributeDefinitions);
+    moveAssign(attributeDefaults, other.attributeDefaults);
+    moveAssign(attributeValues, other.attributeValues);
+    moveAssign(attributeRelationValues, other.attributeRelationValues);
+    return *this;
+}
 
-    /* Environment Variable Data (ENVVAR_DATA) */
-    for (const auto & environmentVariable : network.environmentVariables) {
-        if (environmentVariable.second.type == EnvironmentVariable::Type::Data) {
-            os << "ENVVAR_DATA_ " << environmentVariable.second.name;
-            os << ": " << environmentVariable.second.dataSize;
-            os << ";" << endl;
-        }
-    }
-    os << endl; // this might go below SGTYPE
+std::ostream & operator<<(std::ostream & os, const Network & network) {
+    /* one serializer for streams, buffers and files */
+    NetworkWriter writer(NetworkWriter::streamSink(os));
+    writer.write(network);
 
-    /* Signal Types (SGTYPE, obsolete) */
-    // @todo writeSignalTypes(ofs, network);
+    return os;
+}
 
-    /* Comments (CM) */
-    if (!network.comment.empty())
-        os << "CM_ \"" << network.comment << "\";" << endl;
-    for (const auto & node : network.nodes) {
-        if (!node.second.comment.empty())
-            os << "CM_ BU_ " << node.second.name << " \"" << node.second.comment << "\";" << endl;
-    }
-    for (const auto & message : network.messages) {
-        if (!message.second.comment.empty())
-            os << "CM_ BO_ " << message.second.id << " \"" << message.second.comment << "\";" << endl;
-    }
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            if (!signal.second.comment.empty())
-                os << "CM_ SG_ " << message.second.id << ' ' << signal.second.name << " \"" << signal.second.comment << "\";" << endl;
-        }
-    }
-    for (const auto & environmentVariable : network.environmentVariables) {
-        if (!environmentVariable.second.comment.empty())
-            os << "CM_ EV_ " << environmentVariable.second.name << " \"" << environmentVariable.second.comment << "\";" << endl;
-    }
+/**
+ * @brief Parse network
+ * @param[in] scanner Scanner
+ * @param[out] network Network
+ * @return true if successfully parsed
+ */
+static bool parse(Scanner & scanner, Network & network) {
+    /* Bison parser */
+    Parser parser(&scanner, &network);
 
-    /* Attribute Definitions (BA_DEF) and Attribute Definitions at Relations (BA_DEF_REL) */
-    for (const auto & attributeDefinition : network.attributeDefinitions)
-        os << attributeDefinition.second;
+    /* parse */
+    network.successfullyParsed = (parser.parse() == 0);
 
-    /* Sigtype Attr Lists (?, obsolete) */
+    return network.successfullyParsed;
+}
 
-    /* Attribute Defaults (BA_DEF_DEF) and Attribute Defaults at Relations (BA_DEF_DEF_REL) */
-    for (const auto & attributeDefault : network.attributeDefaults) {
-        const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeDefault.second.name);
+std::istream & operator>>(std::istream & is, Network & network) {
+    /* scanner */
+    Scanner scanner(is);
 
-        /* Object Type */
-        switch (attributeDefinition.objectType) {
-        case AttributeObjectType::Network:
-        case AttributeObjectType::Node:
-        case AttributeObjectType::Message:
-        case AttributeObjectType::Signal:
-        case AttributeObjectType::EnvironmentVariable:
-            os << "BA_DEF_DEF_ ";
-            break;
-        case AttributeObjectType::ControlUnitEnvironmentVariable:
-        case AttributeObjectType::NodeTxMessage:
-        case AttributeObjectType::NodeMappedRxSignal:
-            os << "BA_DEF_DEF_REL_";
-            break;
-        }
+    /* parse */
+    parse(scanner, network);
 
-        /* Name */
-        os << " \"" << attributeDefault.second.name << "\" ";
+    return is;
+}
 
-        /* Value */
-        switch (attributeDefinition.valueType.type) {
-        case AttributeValueType::Type::Int:
-            os << attributeDefault.second.integerValue;
-            break;
-        case AttributeValueType::Type::Hex:
-            os << attributeDefault.second.hexValue;
-            break;
-        case AttributeValueType::Type::Float:
-            os << attributeDefault.second.floatValue;
-            break;
-        case AttributeValueType::Type::String:
-            os << '"' << attributeDefault.second.stringValue << '"';
-            break;
-        case AttributeValueType::Type::Enum:
-            os << '"' << attributeDefault.second.stringValue << '"';
-            break;
-        }
-        os << ';' << endl;
-    }
+/** minimum size of a messages fragment for parallel loading */
+static const std::size_t minimumFragmentSize = 0x1000;
 
-    /* Attribute Values (BA) */
-    for (const auto & attributeValue : network.attributeValues) {
-        const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeValue.second.name);
+/**
+ * Fragment of the input for parallel loading
+ */
+struct Fragment {
+    /** data */
+    const char * data {};
 
-        /* Name */
-        os << "BA_ \"" << attributeValue.second.name << "\" ";
+    /** size of data */
+    std::size_t size {};
 
-        /* Value */
-        switch (attributeDefinition.valueType.type) {
-        case AttributeValueType::Type::Int:
-            os << attributeValue.second.integerValue;
-            break;
-        case AttributeValueType::Type::Hex:
-            os << attributeValue.second.hexValue;
-            break;
-        case AttributeValueType::Type::Float:
-            os << attributeValue.second.floatValue;
-            break;
-        case AttributeValueType::Type::String:
-            os << '"' << attributeValue.second.stringValue << '"';
-            break;
-        case AttributeValueType::Type::Enum:
-            os << attributeValue.second.enumValue;
-            break;
-        }
-        os << ';' << endl;
-    }
-    for (const auto & node : network.nodes) {
-        for (const auto & attributeValue : node.second.attributeValues) {
-            const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeValue.second.name);
-
-            /* Name */
-            os << "BA_ \"" << attributeValue.second.name << "\" ";
-
-            /* Node Name */
-            os << "BU_ " << node.second.name << ' ';
-
-            /* Value */
-            switch (attributeDefinition.valueType.type) {
-            case AttributeValueType::Type::Int:
-                os << attributeValue.second.integerValue;
-                break;
-            case AttributeValueType::Type::Hex:
-                os << attributeValue.second.hexValue;
-                break;
-            case AttributeValueType::Type::Float:
-                os << attributeValue.second.floatValue;
-                break;
-            case AttributeValueType::Type::String:
-                os << '"' << attributeValue.second.stringValue << '"';
-                break;
-            case AttributeValueType::Type::Enum:
-                os << attributeValue.second.enumValue;
-                break;
-            }
-            os << ';' << endl;
-        }
-    }
-    for (const auto & message : network.messages) {
-        for (const auto & attributeValue : message.second.attributeValues) {
-            const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeValue.second.name);
-
-            /* Name */
-            os << "BA_ \"" << attributeValue.second.name << "\" ";
-
-            /* Message Name */
-            os << "BO_ " << message.second.id << ' ';
-
-            /* Value */
-            switch (attributeDefinition.valueType.type) {
-            case AttributeValueType::Type::Int:
-                os << attributeValue.second.integerValue;
-                break;
-            case AttributeValueType::Type::Hex:
-                os << attributeValue.second.hexValue;
-                break;
-            case AttributeValueType::Type::Float:
-                os << attributeValue.second.floatValue;
-                break;
-            case AttributeValueType::Type::String:
-                os << '"' << attributeValue.second.stringValue << '"';
-                break;
-            case AttributeValueType::Type::Enum:
-                os << attributeValue.second.enumValue;
-                break;
-            }
-            os << ';' << endl;
-        }
-    }
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            for (const auto & attributeValue : signal.second.attributeValues) {
-                const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeValue.second.name);
-
-                /* Name */
-                os << "BA_ \"" << attributeValue.second.name << "\" ";
-
-                /* Message Identifier, Signal Name */
-                os << "SG_ " << message.second.id << ' ' << signal.second.name << ' ';
-
-                /* Value */
-                switch (attributeDefinition.valueType.type) {
-                case AttributeValueType::Type::Int:
-                    os << attributeValue.second.integerValue;
-                    break;
-                case AttributeValueType::Type::Hex:
-                    os << attributeValue.second.hexValue;
-                    break;
-                case AttributeValueType::Type::Float:
-                    os << attributeValue.second.floatValue;
-                    break;
-                case AttributeValueType::Type::String:
-                    os << '"' << attributeValue.second.stringValue << '"';
-                    break;
-                case AttributeValueType::Type::Enum:
-                    os << attributeValue.second.enumValue;
-                    break;
-                }
-                os << ';' << endl;
-            }
-        }
-    }
-    for (const auto & environmentVariable : network.environmentVariables) {
-        for (const auto & attributeValue : environmentVariable.second.attributeValues) {
-            const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeValue.second.name);
-
-            /* Name */
-            os << "BA_ \"" << attributeValue.second.name << "\" ";
-
-            /* Environment Variable Name */
-            os << "EV_ " << environmentVariable.second.name << ' ';
-
-            /* Value */
-            switch (attributeDefinition.valueType.type) {
-            case AttributeValueType::Type::Int:
-                os << attributeValue.second.integerValue;
-                break;
-            case AttributeValueType::Type::Hex:
-                os << attributeValue.second.hexValue;
-                break;
-            case AttributeValueType::Type::Float:
-                os << attributeValue.second.floatValue;
-                break;
-            case AttributeValueType::Type::String:
-                os << '"' << attributeValue.second.stringValue << '"';
-                break;
-            case AttributeValueType::Type::Enum:
-                os << attributeValue.second.enumValue;
-                break;
-            }
-            os << ';' << endl;
-        }
-    }
+    /** fragment only contains message definitions (BO_, SG_) */
+    bool messagesOnly {};
 
-    /* Attribute Values at Relations (BA_REL) */
-    for (const auto & attributeRelationValue : network.attributeRelationValues) {
-        const AttributeDefinition & attributeDefinition = network.attributeDefinitions.at(attributeRelationValue.second.name);
-
-        /* Name */
-        os << "BA_REL_ \"" << attributeRelationValue.second.name << "\" ";
-
-        /* Relation Type */
-        switch (attributeRelationValue.second.objectType) {
-        case AttributeObjectType::Network:
-        case AttributeObjectType::Node:
-        case AttributeObjectType::Message:
-        case AttributeObjectType::Signal:
-        case AttributeObjectType::EnvironmentVariable:
-            /* not handled here */
-            break;
-        case AttributeObjectType::ControlUnitEnvironmentVariable:
-            os << "BU_EV_REL_ ";
-            os << attributeRelationValue.second.nodeName;
-            os << ' ';
-            os << attributeRelationValue.second.environmentVariableName;
-            break;
-        case AttributeObjectType::NodeTxMessage:
-            os << "BU_BO_REL_ ";
-            os << attributeRelationValue.second.nodeName;
-            os << ' ';
-            os << attributeRelationValue.second.messageId;
-            break;
-        case AttributeObjectType::NodeMappedRxSignal:
-            os << "BU_SG_REL_ ";
-            os << attributeRelationValue.second.nodeName;
-            os << " SG_ ";
-            os << attributeRelationValue.second.messageId;
-            os << ' ';
-            os << attributeRelationValue.second.signalName;
-            break;
-        }
-        os << ' ';
+    /** parsed network, created by the parsing thread */
+    std::unique_ptr<Network> network {};
 
-        /* Value Type */
-        switch (attributeDefinition.valueType.type) {
-        case AttributeValueType::Type::Int:
-            os << attributeRelationValue.second.integerValue;
-            break;
-        case AttributeValueType::Type::Hex:
-            os << attributeRelationValue.second.hexValue;
-            break;
-        case AttributeValueType::Type::Float:
-            os << attributeRelationValue.second.floatValue;
-            break;
-        case AttributeValueType::Type::String:
-            os << '"' << attributeRelationValue.second.stringValue << '"';
-            break;
-        case AttributeValueType::Type::Enum:
-            os << attributeRelationValue.second.enumValue;
-            break;
-        }
-        os << ';' << endl;
-    }
+    /** successfully parsed */
+    bool parsed {};
 
-    /* Value Descriptions (VAL) */
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            if (!signal.second.valueDescriptions.empty()) {
-                os << "VAL_ " << message.second.id << ' ' << signal.second.name;
-                for (const auto & valueDescription : signal.second.valueDescriptions) {
-                    os << " " << valueDescription.first;
-                    os << " \"" << valueDescription.second << "\"";
-                }
-                os << " ;" << endl;
-            }
-        }
-    }
-    for (const auto & environmentVariable : network.environmentVariables) {
-        if (!environmentVariable.second.valueDescriptions.empty()) {
-            os << "VAL_ " << environmentVariable.second.name;
-            for (const auto & valueDescription : environmentVariable.second.valueDescriptions) {
-                os << " " << valueDescription.first;
-                os << " \"" << valueDescription.second << "\"";
-            }
-            os << " ;" << endl;
-        }
-    }
+    /** diagnostics were suppressed */
+    bool unreportedErrors {};
+};
 
-    /* Category Definitions (CAT_DEF, obsolete) */
+/**
+ * @brief Parse fragment without reporting errors
+ * @param[inout] fragment Fragment
+ */
+static void parseFragment(Fragment & fragment) {
+    try {
+        /* containers take the arena of the parsing thread, as an arena is used by one thread only */
+        fragment.network.reset(new Network());
+        Scanner scanner(fragment.data, fragment.size);
+        scanner.reportErrors = false;
+        if (fragment.messagesOnly)
+            scanner.startMessagesFragment();
+        fragment.parsed = parse(scanner, *fragment.network);
+        fragment.unreportedErrors = (scanner.unreportedErrors != 0);
+    } catch (...) {
+        fragment.parsed = false;
+    }
+}
 
-    /* Categories (CAT, obsolete) */
+/**
+ * @brief Get start of next line
+ * @param[in] line Position within line
+ * @param[in] end End of data
+ * @return Start of next line or end of data
+ */
+static const char * nextLine(const char * line, const char * end) {
+    const char * lineEnd = static_cast<const char *>(std::memchr(line, '\n', static_cast<std::size_t>(end - line)));
+    return (lineEnd == nullptr) ? end : (lineEnd + 1);
+}
 
-    /* Filters (FILTER, obsolete) */
+/**
+ * @brief Check if line starts with a message definition (BO_)
+ * @param[in] line Start of line
+ * @param[in] end End of data
+ * @return true if line starts with BO_
+ */
+static bool isMessageLine(const char * line, const char * end) {
+    return (end - line >= 4) && (std::memcmp(line, "BO_", 3) == 0) && ((line[3] == ' ') || (line[3] == '\t'));
+}
 
-    /* Signal Type Refs (SGTYPE, obsolete) */
-    for (const auto & signalType : network.signalTypes)
-        os << signalType.second;
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            if (!signal.second.type.empty())
-                os << "SGTYPE_ " << message.second.id << ' ' << signal.second.name << " : " << signal.second.type << ";" << endl;
-        }
+/**
+ * @brief Merge a message with the definitions following the messages section
+ * @param[inout] message Message as defined in messages section (BO_, SG_)
+ * @param[in] otherMessage Message as defined by all other sections
+ *
+ * The other sections only set these fields, so they are taken as a whole.
+ */
+static void mergeMessage(Message & message, Message & otherMessage) {
+    message.transmitters = std::move(otherMessage.transmitters);
+    message.signalGroups = std::move(otherMessage.signalGroups);
+    message.comment = std::move(otherMessage.comment);
+    message.attributeValues = std::move(otherMessage.attributeValues);
+    for (auto & otherSignal : otherMessage.signals) {
+        Signal & signal = message.signals[otherSignal.first];
+        signal.extendedValueType = otherSignal.second.extendedValueType;
+        signal.valueDescriptions = std::move(otherSignal.second.valueDescriptions);
+        signal.comment = std::move(otherSignal.second.comment);
+        signal.attributeValues = std::move(otherSignal.second.attributeValues);
+        signal.extendedMultiplexors = std::move(otherSignal.second.extendedMultiplexors);
     }
+}
 
-    /* Signal Groups (SIG_GROUP) */
-    for (const auto & message : network.messages) {
-        for (const auto & signalGroup : message.second.signalGroups)
-            os << signalGroup.second;
+/**
+ * @brief Parse network in parallel
+ * @param[out] network Network
+ * @param[in] data DBC file contents
+ * @param[in] size Size of data
+ * @param[in] threadCount Number of threads
+ * @return true if successfully parsed, false if network is unchanged
+ *
+ * The messages section (BO_, SG_) is split at message definitions into
+ * fragments, which are parsed in own threads. Meanwhile all other
+ * sections are parsed. The messages are then merged in file order.
+ * The threads create their networks without an arena, which are then
+ * copied into the arena of this thread, if any.
+ * Whenever something doesn't parse or a diagnostic was suppressed,
+ * the caller parses sequentially to get the same result and error
+ * messages.
+ */
+static bool parseParallel(Network & network, const char * data, std::size_t size, unsigned int threadCount) {
+    const char * end = data + size;
+
+    /* messages section: from first BO_ line to the next line starting another section */
+    const char * messagesBegin = data;
+    while ((messagesBegin != end) && !isMessageLine(messagesBegin, end))
+        messagesBegin = nextLine(messagesBegin, end);
+    const char * messagesEnd = messagesBegin;
+    while (messagesEnd != end) {
+        messagesEnd = nextLine(messagesEnd, end);
+        if ((messagesEnd == end) || isMessageLine(messagesEnd, end))
+            continue;
+        const char c = *messagesEnd;
+        if ((c != ' ') && (c != '\t') && (c != '\r') && (c != '\n') && (c != '/'))
+            break;
     }
-
-    /* Signal Extended Value Types (SIG_VALTYPE, obsolete) */
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            if (signal.second.extendedValueType  !=  Signal::ExtendedValueType::Undefined) {
-                os << "SIG_VALTYPE_ " << message.second.id << ' ' << signal.second.name;
-                os << " : " << char(signal.second.extendedValueType);
-                os << ';' << endl;
-            }
+    const std::size_t messagesSize = static_cast<std::size_t>(messagesEnd - messagesBegin);
+    const std::size_t fragmentCount = std::min<std::size_t>(threadCount, messagesSize / minimumFragmentSize);
+    if (fragmentCount < 2)
+        return false;
+
+    /* other sections */
+    std::string otherSections;
+    otherSections.reserve(size - messagesSize);
+    otherSections.append(data, messagesBegin);
+    otherSections.append(messagesEnd, end);
+    std::vector<Fragment> fragments(fragmentCount + 1);
+    fragments[0].data = otherSections.data();
+    fragments[0].size = otherSections.size();
+    fragments[0].messagesOnly = false;
+
+    /* messages fragments of about the same size */
+    const char * fragmentBegin = messagesBegin;
+    for (std::size_t i = 1; i <= fragmentCount; ++i) {
+        const char * fragmentEnd = messagesEnd;
+        if (i < fragmentCount) {
+            fragmentEnd = nextLine(std::max(fragmentBegin, messagesBegin + i * messagesSize / fragmentCount - 1), end);
+            while ((fragmentEnd != messagesEnd) && !isMessageLine(fragmentEnd, end))
+                fragmentEnd = nextLine(fragmentEnd, end);
         }
+        fragments[i].data = fragmentBegin;
+        fragments[i].size = static_cast<std::size_t>(fragmentEnd - fragmentBegin);
+        fragments[i].messagesOnly = true;
+        fragmentBegin = fragmentEnd;
     }
 
-    /* Extended Multiplexors (SG_MUL_VAL) */
-    for (const auto & message : network.messages) {
-        for (const auto & signal : message.second.signals) {
-            for (const auto & extendedMultiplexor : signal.second.extendedMultiplexors) {
-                /* Identifier, Name */
-                os << "SG_MUL_VAL_ " << message.second.id << ' ' << signal.second.name;
-
-                /* Switch Name */
-                os << ' ' << extendedMultiplexor.second.switchName;
-
-                /* Value Ranges */
-                bool first = true;
-                for (const auto & valueRange : extendedMultiplexor.second.valueRanges) {
-                    if (first)
-                        first = false;
-                    else
-                        os << ", ";
-                    os << valueRange.first << '-' << valueRange.second;
-                }
-                os << ';' << endl;
-            }
+    /* parse messages fragments in threads and other sections in this thread */
+    std::vector<std::thread> threads;
+    std::size_t threadedFragments = 1;
+    try {
+        for (; threadedFragments < fragments.size(); ++threadedFragments)
+            threads.emplace_back(parseFragment, std::ref(fragments[threadedFragments]));
+    } catch (const std::system_error &) {
+        /* parse remaining fragments in this thread */
+    }
+    parseFragment(fragments[0]);
+    for (std::size_t i = threadedFragments; i < fragments.size(); ++i)
+        parseFragment(fragments[i]);
+    for (std::thread & thread : threads)
+        thread.join();
+    for (const Fragment & fragment : fragments)
+        if (!fragment.parsed || fragment.unreportedErrors)
+            return false;
+
+    /* other sections never name messages, otherwise there was a BO_ outside the messages section */
+    Network & result = *fragments[0].network;
+    ArenaMap<uint32_t, Message> otherMessages;
+    otherMessages.swap(result.messages);
+    for (const auto & otherMessage : otherMessages)
+        if (!otherMessage.second.name.empty())
+            return false;
+
+    /* merge messages in file order, later definitions replace earlier ones */
+    for (std::size_t i = 1; i < fragments.size(); ++i) {
+        ArenaMap<uint32_t, Message> & messages = fragments[i].network->messages;
+        if (messages.get_allocator() == result.messages.get_allocator()) {
+            for (auto & message : messages)
+                result.messages[message.first] = std::move(message.second);
+        } else {
+            /* messages of other threads are on the heap, copy them into the arena of this thread */
+            for (const auto & message : messages)
+                result.messages[message.first] = message.second;
         }
     }
+    for (auto & otherMessage : otherMessages)
+        mergeMessage(result.messages[otherMessage.first], otherMessage.second);
 
-    os << endl;
+    network = std::move(result);
+    return true;
+}
 
-    return os;
+bool loadFile(Network & network, const std::string & fileName, unsigned int threadCount) {
+    /* map file */
+    MappedFile mappedFile(fileName);
+    if (!mappedFile.isOpen()) {
+        network.successfullyParsed = false;
+        return false;
+    }
+
+    return loadBuffer(network, mappedFile.data(), mappedFile.size(), threadCount);
 }
 
-std::istream & operator>>(std::istream & is, Network & network) {
-    /* Flex scanner */
-    Scanner scanner(is);
+bool loadBuffer(Network & network, const char * data, std::size_t size, unsigned int threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
 
-    /* Bison parser */
-    Parser parser(&scanner, &network);
+    /* parallel parser */
+    if ((threadCount > 1) && parseParallel(network, data, size, threadCount))
+        return true;
 
-    /* parse */
-    network.successfullyParsed = (parser.parse() == 0);
+    /* scanner */
+    Scanner scanner(data, size);
 
-    return is;
+    /* parse */
+    return parse(scanner, network);
 }
 
 }
@@ -23,6 +23,7 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <map>
@@ -30,6 +31,7 @@
 #include <string>
 #include <vector>
 
+#include <Vector/DBC/Arena.h>
 #include <Vector/DBC/Attribute.h>
 #include <Vector/DBC/AttributeDefinition.h>
 #include <Vector/DBC/AttributeRelation.h>
@@ -38,6 +40,7 @@
 #include <Vector/DBC/Message.h>
 #include <Vector/DBC/Node.h>
 #include <Vector/DBC/SignalType.h>
+#include <Vector/DBC/Symbol.h>
 #include <Vector/DBC/ValueDescriptions.h>
 #include <Vector/DBC/ValueTable.h>
 
@@ -48,8 +51,31 @@ namespace DBC {
 
 /**
  * Network
+ *
+ * The containers (ArenaMap, ArenaSet, ArenaVector) of the network and of
+ * its nodes, messages, signals etc. bind on construction to the current
+ * arena of the constructing thread (see ArenaScope), or to the heap if
+ * there is none. They keep that binding: assigning a network from
+ * another arena copies the elements into it.
  */
 struct VECTOR_DBC_EXPORT Network {
+    Network() = default;
+    Network(const Network &) = default;
+    Network(Network &&) = default;
+    Network & operator=(const Network &) = default;
+    ~Network() = default;
+
+    /**
+     * @brief Move network
+     * @param[in] other Other network
+     * @return This network
+     *
+     * Containers, which allocate from another arena than those of this
+     * network, are copied instead of moved. So this network never refers
+     * to the arena of the other network.
+     */
+    Network & operator=(Network && other);
+
     /** successfully parsed */
     bool successfullyParsed { false };
 
@@ -57,31 +83,31 @@ struct VECTOR_DBC_EXPORT Network {
     std::string version {};
 
     /** New Symbols (NS) */
-    std::vector<std::string> newSymbols {};
+    ArenaVector<std::string> newSymbols {};
 
     /** Bit Timing (BS) */
     BitTiming bitTiming {};
 
     /** Nodes (BU) */
-    std::map<std::string, Node> nodes {};
+    ArenaMap<std::string, Node> nodes {};
 
     /** Value Tables (VAL_TABLE) */
-    std::map<std::string, ValueTable> valueTables {};
+    ArenaMap<std::string, ValueTable> valueTables {};
 
     /** Messages (BO) and Signals (SG) */
-    std::map<uint32_t, Message> messages {};
+    ArenaMap<uint32_t, Message> messages {};
 
     /* Message Transmitters (BO_TX_BU) */
     // moved to Message (BO)
 
     /** Environment Variables (EV) */
-    std::map<std::string, EnvironmentVariable> environmentVariables {};
+    ArenaMap<std::string, EnvironmentVariable> environmentVariables {};
 
     /* Environment Variables Data (ENVVAR_DATA) */
     // moved to Environment Variables (EV)
 
     /** Signal Types (SGTYPE, obsolete) */
-    std::map<std::string, SignalType> signalTypes {};
+    ArenaMap<std::string, SignalType> signalTypes {};
 
     /** Comments (CM) */
     std::string comment {}; // for network
@@ -94,7 +120,7 @@ struct VECTOR_DBC_EXPORT Network {
      * Attribute Definitions (BA_DEF) and
      * Attribute Definitions for Relations (BA_DEF_REL)
      */
-    std::map<std::string, AttributeDefinition> attributeDefinitions {};
+    ArenaMap<std::string, AttributeDefinition> attributeDefinitions {};
 
     /* Sigtype Attr List (?, obsolete) */
 
@@ -102,17 +128,17 @@ struct VECTOR_DBC_EXPORT Network {
      * Attribute Defaults (BA_DEF_DEF) and
      * Attribute Defaults for Relations (BA_DEF_DEF_REL)
      */
-    std::map<std::string, Attribute> attributeDefaults {};
+    ArenaMap<Symbol, Attribute> attributeDefaults {};
 
     /** Attribute Values (BA) */
-    std::map<std::string, Attribute> attributeValues {}; // for network
+    ArenaMap<Symbol, Attribute> attributeValues {}; // for network
     // moved to Node (BU) for nodes
     // moved to Message (BO) for messages
     // moved to Signal (SG) for signals
     // moved to Environment Variable (EV) for environment variables
 
     /** Attribute Values on Relations (BA_REF) */
-    std::map<std::string, AttributeRelation> attributeRelationValues {};
+    ArenaMap<std::string, AttributeRelation> attributeRelationValues {};
 
     /* Value Descriptions (VAL) */
     // moved to Signals (BO) for signals
@@ -140,5 +166,35 @@ struct VECTOR_DBC_EXPORT Network {
 VECTOR_DBC_EXPORT std::ostream & operator<<(std::ostream & os, const Network & network);
 VECTOR_DBC_EXPORT std::istream & operator>>(std::istream & is, Network & network);
 
+/**
+ * @brief Load network from file
+ * @param[out] network Network
+ * @param[in] fileName File name
+ * @param[in] threadCount Number of threads (0 for one per hardware thread)
+ * @return true if the file was read and successfully parsed
+ *
+ * The file is memory mapped and scanned in place.
+ * See loadBuffer for parallel loading.
+ */
+VECTOR_DBC_EXPORT bool loadFile(Network & network, const std::string & fileName, unsigned int threadCount = 1);
+
+/**
+ * @brief Load network from memory
+ * @param[out] network Network
+ * @param[in] data DBC file contents
+ * @param[in] size Size of data
+ * @param[in] threadCount Number of threads (0 for one per hardware thread)
+ * @return true if successfully parsed
+ *
+ * The data is scanned in place, e.g. a DBC file embedded in another file.
+ *
+ * With more than one thread, the messages section (BO_, SG_) is split
+ * into fragments, which are parsed concurrently and merged in file order.
+ * The result is the same as with sequential parsing, except that the
+ * network is replaced instead of extended. Small files and files that
+ * don't parse or have unmatched characters are parsed sequentially.
+ */
+VECTOR_DBC_EXPORT bool loadBuffer(Network & network, const char * data, std::size_t size, unsigned int threadCount = 1);
+
 }
 }
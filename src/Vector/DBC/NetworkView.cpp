@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/NetworkView.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace DBC {
+
+using namespace SnapshotFormat;
+
+StringView SignalView::valueDescription(uint32_t value) const {
+    /* value descriptions are sorted by value */
+    const Span<const ValueDescriptionRecord> valueDescriptions = snapshot->records<ValueDescriptionRecord>(record->valueDescriptions);
+    auto it = std::lower_bound(valueDescriptions.begin(), valueDescriptions.end(), value, [](const ValueDescriptionRecord & lhs, uint32_t rhs) {
+        return lhs.value < rhs;
+    });
+    if ((it == valueDescriptions.end()) || (it->value != value))
+        return StringView();
+    return snapshot->stringView(it->description);
+}
+
+SignalView MessageView::findSignal(StringView name) const {
+    /* signals are sorted by name */
+    const Span<const SignalRecord> signals = snapshot->records<SignalRecord>(record->signals);
+    auto it = std::lower_bound(signals.begin(), signals.end(), name, [this](const SignalRecord & lhs, StringView rhs) {
+        return snapshot->stringView(lhs.key) < rhs;
+    });
+    if ((it == signals.end()) || (snapshot->stringView(it->key) != name))
+        return SignalView();
+    return SignalView(*snapshot, *it);
+}
+
+const NetworkRecord & NetworkView::networkRecord(const Snapshot & snapshot) {
+    /* opened snapshots have exactly one network record */
+    static const NetworkRecord emptyRecord {};
+    if (!snapshot.isOpen())
+        return emptyRecord;
+    return snapshot.records<NetworkRecord>()[0];
+}
+
+MessageView NetworkView::findMessage(uint32_t id) const {
+    const Span<const MessageRecord> messages = snapshot.records<MessageRecord>();
+    const Span<const MessageIdSlot> slots = snapshot.records<MessageIdSlot>();
+
+    /* without lookup table, messages are sorted by identifier */
+    if (slots.empty()) {
+        auto it = std::lower_bound(messages.begin(), messages.end(), id, [](const MessageRecord & lhs, uint32_t rhs) {
+            return lhs.key < rhs;
+        });
+        if ((it == messages.end()) || (it->key != id))
+            return MessageView();
+        return MessageView(snapshot, *it);
+    }
+
+    /* linear probing */
+    const uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+    for (uint32_t index = slotIndex(id, mask + 1); slots[index].message != emptySlot; index = (index + 1) & mask) {
+        if (slots[index].id == id)
+            return MessageView(snapshot, messages[slots[index].message]);
+    }
+    return MessageView();
+}
+
+MessageView NetworkView::findMessage(StringView name) const {
+    const Span<const MessageRecord> messages = snapshot.records<MessageRecord>();
+    const Span<const MessageNameSlot> slots = snapshot.records<MessageNameSlot>();
+
+    /* without lookup table, search all messages */
+    if (slots.empty()) {
+        for (const MessageRecord & message : messages) {
+            if (!name.empty() && (snapshot.stringView(message.name) == name))
+                return MessageView(snapshot, message);
+        }
+        return MessageView();
+    }
+
+    /* linear probing */
+    const uint32_t hash = nameHash(name.data(), name.size());
+    const uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+    for (uint32_t index = slotIndex(hash, mask + 1); slots[index].message != emptySlot; index = (index + 1) & mask) {
+        if ((slots[index].hash == hash) && (snapshot.stringView(messages[slots[index].message].name) == name))
+            return MessageView(snapshot, messages[slots[index].message]);
+    }
+    return MessageView();
+}
+
+}
+}
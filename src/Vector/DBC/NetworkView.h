@@ -0,0 +1,364 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC/ByteOrder.h>
+#include <Vector/DBC/CompiledSignal.h>
+#include <Vector/DBC/Signal.h>
+#include <Vector/DBC/Snapshot.h>
+#include <Vector/DBC/SnapshotFormat.h>
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/ValueType.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal View
+ *
+ * Read-only access to a signal in a snapshot, see NetworkView.
+ */
+class VECTOR_DBC_EXPORT SignalView {
+  public:
+    SignalView() = default;
+
+    /**
+     * @brief Create view on signal record
+     * @param[in] snapshot Snapshot
+     * @param[in] record Signal record
+     */
+    SignalView(const Snapshot & snapshot, const SnapshotFormat::SignalRecord & record) :
+        snapshot(&snapshot),
+        record(&record) {
+    }
+
+    /**
+     * @brief Check if view refers to a signal
+     * @return false if signal wasn't found
+     */
+    bool isValid() const {
+        return record != nullptr;
+    }
+
+    /** @copydoc Signal::name */
+    StringView name() const {
+        return snapshot->stringView(record->name);
+    }
+
+    /** @copydoc Signal::multiplexor */
+    Signal::Multiplexor multiplexor() const {
+        return static_cast<Signal::Multiplexor>(record->multiplexor);
+    }
+
+    /** @copydoc Signal::multiplexerSwitchValue */
+    uint32_t multiplexerSwitchValue() const {
+        return record->multiplexerSwitchValue;
+    }
+
+    /** @copydoc Signal::startBit */
+    uint32_t startBit() const {
+        return record->startBit;
+    }
+
+    /** @copydoc Signal::bitSize */
+    uint32_t bitSize() const {
+        return record->bitSize;
+    }
+
+    /** @copydoc Signal::byteOrder */
+    ByteOrder byteOrder() const {
+        return static_cast<ByteOrder>(record->byteOrder);
+    }
+
+    /** @copydoc Signal::valueType */
+    ValueType valueType() const {
+        return static_cast<ValueType>(record->valueType);
+    }
+
+    /** @copydoc Signal::factor */
+    double factor() const {
+        return record->factor;
+    }
+
+    /** @copydoc Signal::offset */
+    double offset() const {
+        return record->offset;
+    }
+
+    /** @copydoc Signal::minimum */
+    double minimum() const {
+        return record->minimum;
+    }
+
+    /** @copydoc Signal::maximum */
+    double maximum() const {
+        return record->maximum;
+    }
+
+    /** @copydoc Signal::unit */
+    StringView unit() const {
+        return snapshot->stringView(record->unit);
+    }
+
+    /**
+     * @brief Get number of receivers
+     * @return Number of receivers
+     */
+    std::size_t receiverCount() const {
+        return record->receivers.count;
+    }
+
+    /**
+     * @brief Get receiver
+     * @param[in] index Index (sorted by name)
+     * @return Receiver
+     */
+    StringView receiver(std::size_t index) const {
+        return snapshot->stringView(snapshot->records<SnapshotFormat::String>(record->receivers)[index]);
+    }
+
+    /** @copydoc Signal::extendedValueType */
+    Signal::ExtendedValueType extendedValueType() const {
+        return static_cast<Signal::ExtendedValueType>(record->extendedValueType);
+    }
+
+    /**
+     * @brief Get value description
+     * @param[in] value Raw value
+     * @return Description (empty if there is none)
+     */
+    StringView valueDescription(uint32_t value) const;
+
+    /** @copydoc Signal::type */
+    StringView type() const {
+        return snapshot->stringView(record->type);
+    }
+
+    /** @copydoc Signal::comment */
+    StringView comment() const {
+        return snapshot->stringView(record->comment);
+    }
+
+    /**
+     * @brief Compile signal for decoding/encoding
+     * @return Compiled signal
+     */
+    CompiledSignal compile() const {
+        return CompiledSignal(record->startBit, record->bitSize, byteOrder(), valueType(), record->factor, record->offset);
+    }
+
+  private:
+    /** snapshot */
+    const Snapshot * snapshot {};
+
+    /** signal record */
+    const SnapshotFormat::SignalRecord * record {};
+};
+
+/**
+ * Message View
+ *
+ * Read-only access to a message in a snapshot, see NetworkView.
+ */
+class VECTOR_DBC_EXPORT MessageView {
+  public:
+    MessageView() = default;
+
+    /**
+     * @brief Create view on message record
+     * @param[in] snapshot Snapshot
+     * @param[in] record Message record
+     */
+    MessageView(const Snapshot & snapshot, const SnapshotFormat::MessageRecord & record) :
+        snapshot(&snapshot),
+        record(&record) {
+    }
+
+    /**
+     * @brief Check if view refers to a message
+     * @return false if message wasn't found
+     */
+    bool isValid() const {
+        return record != nullptr;
+    }
+
+    /** @copydoc Message::id */
+    uint32_t id() const {
+        return record->id;
+    }
+
+    /** @copydoc Message::name */
+    StringView name() const {
+        return snapshot->stringView(record->name);
+    }
+
+    /** @copydoc Message::size */
+    uint32_t size() const {
+        return record->size;
+    }
+
+    /** @copydoc Message::transmitter */
+    StringView transmitter() const {
+        return snapshot->stringView(record->transmitter);
+    }
+
+    /**
+     * @brief Get number of signals
+     * @return Number of signals
+     */
+    std::size_t signalCount() const {
+        return record->signals.count;
+    }
+
+    /**
+     * @brief Get signal
+     * @param[in] index Index (sorted by name)
+     * @return Signal
+     */
+    SignalView signal(std::size_t index) const {
+        return SignalView(*snapshot, snapshot->records<SnapshotFormat::SignalRecord>(record->signals)[index]);
+    }
+
+    /**
+     * @brief Find signal by binary search
+     * @param[in] name Signal name
+     * @return Signal (invalid if signal is unknown)
+     */
+    SignalView findSignal(StringView name) const;
+
+    /**
+     * @brief Get number of transmitters (BO_TX_BU)
+     * @return Number of transmitters
+     */
+    std::size_t transmitterCount() const {
+        return record->transmitters.count;
+    }
+
+    /**
+     * @brief Get transmitter (BO_TX_BU)
+     * @param[in] index Index (sorted by name)
+     * @return Transmitter
+     */
+    StringView transmitter(std::size_t index) const {
+        return snapshot->stringView(snapshot->records<SnapshotFormat::String>(record->transmitters)[index]);
+    }
+
+    /** @copydoc Message::comment */
+    StringView comment() const {
+        return snapshot->stringView(record->comment);
+    }
+
+  private:
+    /** snapshot */
+    const Snapshot * snapshot {};
+
+    /** message record */
+    const SnapshotFormat::MessageRecord * record {};
+};
+
+/**
+ * Network View
+ *
+ * Read-only access to a network in a snapshot, reading all fields in
+ * place, without creating maps or strings. Messages are found with the
+ * lookup tables of the snapshot, signals by binary search within their
+ * message.
+ *
+ * Views refer to the snapshot, so the snapshot and its data must stay
+ * valid while views are used.
+ */
+class VECTOR_DBC_EXPORT NetworkView {
+  public:
+    /**
+     * @brief Create view on snapshot
+     * @param[in] snapshot Opened snapshot (otherwise the view is empty)
+     */
+    explicit NetworkView(const Snapshot & snapshot) :
+        snapshot(snapshot),
+        record(networkRecord(snapshot)) {
+    }
+
+    /** @copydoc Network::version */
+    StringView version() const {
+        return snapshot.stringView(record.version);
+    }
+
+    /** @copydoc Network::comment */
+    StringView comment() const {
+        return snapshot.stringView(record.comment);
+    }
+
+    /**
+     * @brief Get number of messages
+     * @return Number of messages
+     */
+    std::size_t messageCount() const {
+        return record.messages.count;
+    }
+
+    /**
+     * @brief Get message
+     * @param[in] index Index (sorted by identifier)
+     * @return Message
+     */
+    MessageView message(std::size_t index) const {
+        return MessageView(snapshot, snapshot.records<SnapshotFormat::MessageRecord>(record.messages)[index]);
+    }
+
+    /**
+     * @brief Find message by identifier
+     * @param[in] id Message Identifier (bit 31 set for extended frames)
+     * @return Message (invalid if message is unknown)
+     */
+    MessageView findMessage(uint32_t id) const;
+
+    /**
+     * @brief Find message by name
+     * @param[in] name Message name
+     * @return Message (invalid if message is unknown)
+     */
+    MessageView findMessage(StringView name) const;
+
+  private:
+    /** snapshot */
+    const Snapshot & snapshot;
+
+    /** network record */
+    const SnapshotFormat::NetworkRecord & record;
+
+    /**
+     * @brief Get network record
+     * @param[in] snapshot Snapshot
+     * @return Network record (empty record if the snapshot isn't open)
+     */
+    static const SnapshotFormat::NetworkRecord & networkRecord(const Snapshot & snapshot);
+};
+
+}
+}
@@ -0,0 +1,828 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/NetworkWriter.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Vector {
+namespace DBC {
+
+/** largest magnitude of doubles, which are written as integer (fewer digits than the precision) */
+static const double maximumIntegralDouble = 1e15;
+
+NetworkWriter::NetworkWriter(Sink sink, std::size_t blockSize) :
+    sink(std::move(sink)),
+    blockSize(blockSize) {
+    output.reserve(blockSize + 0x1000);
+}
+
+NetworkWriter::Sink NetworkWriter::fileDescriptorSink(int fileDescriptor) {
+    return [fileDescriptor](const char * data, std::size_t size) {
+        while (size > 0) {
+#if defined(_WIN32)
+            const int written = _write(fileDescriptor, data, static_cast<unsigned int>(std::min<std::size_t>(size, 0x40000000)));
+#else
+            const ssize_t written = ::write(fileDescriptor, data, size);
+#endif
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    };
+}
+
+NetworkWriter::Sink NetworkWriter::streamSink(std::ostream & os) {
+    return [&os](const char * data, std::size_t size) {
+        os.write(data, static_cast<std::streamsize>(size));
+        return static_cast<bool>(os);
+    };
+}
+
+bool NetworkWriter::flush() {
+    if (!sink || output.empty())
+        return !failed;
+
+    if (!failed)
+        failed = !sink(output.data(), output.size());
+    output.clear();
+    return !failed;
+}
+
+void NetworkWriter::appendEndl() {
+    output.append(endl);
+    if (sink && (output.size() >= blockSize))
+        flush();
+}
+
+void NetworkWriter::appendUnsigned(uint64_t value) {
+    /* digits from the end */
+    char digits[20];
+    char * digit = digits + sizeof(digits);
+    do {
+        *--digit = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    output.append(digit, static_cast<std::size_t>(digits + sizeof(digits) - digit));
+}
+
+void NetworkWriter::appendSigned(int64_t value) {
+    if (value < 0) {
+        output.push_back('-');
+        appendUnsigned(0 - static_cast<uint64_t>(value));
+    } else
+        appendUnsigned(static_cast<uint64_t>(value));
+}
+
+void NetworkWriter::appendHex(uint32_t value) {
+    static const char hexDigits[] = "0123456789abcdef";
+    char digits[8];
+    char * digit = digits + sizeof(digits);
+    do {
+        *--digit = hexDigits[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+    output.append(digit, static_cast<std::size_t>(digits + sizeof(digits) - digit));
+}
+
+void NetworkWriter::appendDouble(double value) {
+    /* integral values, as most factors, offsets and limits, are written like %.16g does */
+    if ((value == std::trunc(value)) && (std::fabs(value) < maximumIntegralDouble) && !((value == 0) && std::signbit(value))) {
+        appendSigned(static_cast<int64_t>(value));
+        return;
+    }
+
+    /* same as operator<< with precision 16, in C locale */
+    char digits[32];
+    const int size = std::snprintf(digits, sizeof(digits), "%.16g", value);
+    for (int i = 0; i < size; ++i) {
+        if (digits[i] == ',')
+            digits[i] = '.';
+    }
+    output.append(digits, static_cast<std::size_t>(size));
+}
+
+void NetworkWriter::appendValueDescriptions(const ValueDescriptions & valueDescriptions) {
+    for (const auto & valueDescription : valueDescriptions) {
+        append(' ');
+        appendUnsigned(valueDescription.first);
+        append(" \"");
+        append(valueDescription.second);
+        append('"');
+    }
+    append(" ;");
+    appendEndl();
+}
+
+const AttributeDefinition & NetworkWriter::attributeDefinition(const Symbol & name) const {
+    auto it = attributeDefinitions.find(name);
+    if (it == attributeDefinitions.end())
+        throw std::out_of_range("attribute not defined: " + name.str());
+    return *it->second;
+}
+
+void NetworkWriter::appendAttributeValue(const Attribute & attribute, bool isDefault) {
+    switch (attributeDefinition(attribute.name).valueType.type) {
+    case AttributeValueType::Type::Int:
+        appendSigned(attribute.integerValue);
+        break;
+    case AttributeValueType::Type::Hex:
+        appendSigned(attribute.hexValue);
+        break;
+    case AttributeValueType::Type::Float:
+        appendDouble(attribute.floatValue);
+        break;
+    case AttributeValueType::Type::String:
+        append('"');
+        append(attribute.stringValue);
+        append('"');
+        break;
+    case AttributeValueType::Type::Enum:
+        if (isDefault) {
+            append('"');
+            append(attribute.stringValue);
+            append('"');
+        } else
+            appendSigned(attribute.enumValue);
+        break;
+    }
+    append(';');
+    appendEndl();
+}
+
+void NetworkWriter::writeSignal(const Signal & signal) {
+    /* Name */
+    append(" SG_ ");
+    append(signal.name);
+    append(' ');
+
+    /* Multiplexed Signal, Multiplexor Switch/Signal */
+    switch (signal.multiplexor) {
+    case Signal::Multiplexor::NoMultiplexor:
+        append(' ');
+        break;
+    case Signal::Multiplexor::MultiplexedSignal:
+        append('m');
+        appendUnsigned(signal.multiplexerSwitchValue);
+        break;
+    case Signal::Multiplexor::MultiplexorSwitch:
+        append('M');
+        break;
+    }
+    append(": ");
+
+    /* Start Bit, Size, Byte Order, Value Type */
+    appendUnsigned(signal.startBit);
+    append('|');
+    appendUnsigned(signal.bitSize);
+    append('@');
+    append(char(signal.byteOrder));
+    append(char(signal.valueType));
+
+    /* Factor, Offset */
+    append(" (");
+    appendDouble(signal.factor);
+    append(',');
+    appendDouble(signal.offset);
+    append(')');
+
+    /* Minimum, Maximum */
+    append(" [");
+    appendDouble(signal.minimum);
+    append('|');
+    appendDouble(signal.maximum);
+    append(']');
+
+    /* Unit */
+    append(" \"");
+    append(signal.unit);
+    append("\" ");
+
+    /* Receivers */
+    if (signal.receivers.empty())
+        append("Vector__XXX");
+    else {
+        for (const auto & receiver : signal.receivers) {
+            append(' ');
+            append(receiver.str());
+        }
+    }
+    appendEndl();
+}
+
+void NetworkWriter::writeMessage(const Message & message) {
+    append("BO_ ");
+    appendUnsigned(message.id);
+    append(' ');
+    append(message.name);
+    append(": ");
+    appendUnsigned(message.size);
+    append(' ');
+    if (message.transmitter.empty())
+        append("Vector__XXX");
+    else
+        append(message.transmitter.str());
+    appendEndl();
+
+    /* Signals (SG) */
+    for (const auto & signal : message.signals)
+        writeSignal(signal.second);
+
+    appendEndl();
+}
+
+void NetworkWriter::writeEnvironmentVariable(const EnvironmentVariable & environmentVariable) {
+    append("EV_ ");
+    append(environmentVariable.name);
+    append(": ");
+
+    /* Type */
+    switch (environmentVariable.type) {
+    case EnvironmentVariable::Type::Integer:
+    // [[fallthrough]]
+    case EnvironmentVariable::Type::String:
+    // [[fallthrough]]
+    case EnvironmentVariable::Type::Data:
+        append('0');
+        break;
+    case EnvironmentVariable::Type::Float:
+        append('1');
+        break;
+    }
+
+    /* Minimum, Maximum */
+    append(" [");
+    appendDouble(environmentVariable.minimum);
+    append('|');
+    appendDouble(environmentVariable.maximum);
+    append(']');
+
+    /* Unit */
+    append(" \"");
+    append(environmentVariable.unit);
+    append("\" ");
+
+    /* Initial Value */
+    appendDouble(environmentVariable.initialValue);
+    append(' ');
+
+    /* ID */
+    appendUnsigned(environmentVariable.id);
+
+    /* Access Type */
+    append(" DUMMY_NODE_VECTOR");
+    if (environmentVariable.type == EnvironmentVariable::Type::String)
+        appendHex(static_cast<uint16_t>(environmentVariable.accessType) | 0x8000);
+    else
+        appendHex(static_cast<uint16_t>(environmentVariable.accessType));
+    append(' ');
+
+    /* Access Nodes */
+    if (environmentVariable.accessNodes.empty())
+        append("Vector__XXX");
+    else {
+        append(' ');
+        bool first = true;
+        for (const auto & accessNode : environmentVariable.accessNodes) {
+            if (first)
+                first = false;
+            else
+                append(',');
+            append(accessNode.str());
+        }
+    }
+    append(';');
+    appendEndl();
+}
+
+void NetworkWriter::writeAttributeDefinition(const AttributeDefinition & attributeDefinition) {
+    /* Object Type */
+    switch (attributeDefinition.objectType) {
+    case AttributeObjectType::Network:
+        append("BA_DEF_ ");
+        break;
+    case AttributeObjectType::Node:
+        append("BA_DEF_ BU_ ");
+        break;
+    case AttributeObjectType::Message:
+        append("BA_DEF_ BO_ ");
+        break;
+    case AttributeObjectType::Signal:
+        append("BA_DEF_ SG_ ");
+        break;
+    case AttributeObjectType::EnvironmentVariable:
+        append("BA_DEF_ EV_ ");
+        break;
+    case AttributeObjectType::ControlUnitEnvironmentVariable:
+        append("BA_DEF_REL_ BU_EV_REL_ ");
+        break;
+    case AttributeObjectType::NodeTxMessage:
+        append("BA_DEF_REL_ BU_BO_REL_ ");
+        break;
+    case AttributeObjectType::NodeMappedRxSignal:
+        append("BA_DEF_REL_ BU_SG_REL_ ");
+        break;
+    }
+
+    /* Name */
+    append(" \"");
+    append(attributeDefinition.name);
+    append("\" ");
+
+    /* Value Type */
+    const AttributeValueType & valueType = attributeDefinition.valueType;
+    switch (valueType.type) {
+    case AttributeValueType::Type::Int:
+        append("INT ");
+        appendSigned(valueType.integerValue.minimum);
+        append(' ');
+        appendSigned(valueType.integerValue.maximum);
+        break;
+    case AttributeValueType::Type::Hex:
+        append("HEX ");
+        appendSigned(valueType.hexValue.minimum);
+        append(' ');
+        appendSigned(valueType.hexValue.maximum);
+        break;
+    case AttributeValueType::Type::Float:
+        append("FLOAT ");
+        appendDouble(valueType.floatValue.minimum);
+        append(' ');
+        appendDouble(valueType.floatValue.maximum);
+        break;
+    case AttributeValueType::Type::String:
+        append("STRING ");
+        break;
+    case AttributeValueType::Type::Enum:
+        append("ENUM  ");
+        bool first = true;
+        for (const auto & enumValue : valueType.enumValues) {
+            if (first)
+                first = false;
+            else
+                append(',');
+            append('"');
+            append(enumValue);
+            append('"');
+        }
+        break;
+    }
+
+    append(';');
+    appendEndl();
+}
+
+void NetworkWriter::writeAttributeRelation(const AttributeRelation & attributeRelation) {
+    /* Name */
+    append("BA_REL_ \"");
+    append(attributeRelation.name.str());
+    append("\" ");
+
+    /* Relation Type */
+    switch (attributeRelation.objectType) {
+    case AttributeObjectType::Network:
+    case AttributeObjectType::Node:
+    case AttributeObjectType::Message:
+    case AttributeObjectType::Signal:
+    case AttributeObjectType::EnvironmentVariable:
+        /* not handled here */
+        break;
+    case AttributeObjectType::ControlUnitEnvironmentVariable:
+        append("BU_EV_REL_ ");
+        append(attributeRelation.nodeName.str());
+        append(' ');
+        append(attributeRelation.environmentVariableName);
+        break;
+    case AttributeObjectType::NodeTxMessage:
+        append("BU_BO_REL_ ");
+        append(attributeRelation.nodeName.str());
+        append(' ');
+        appendUnsigned(attributeRelation.messageId);
+        break;
+    case AttributeObjectType::NodeMappedRxSignal:
+        append("BU_SG_REL_ ");
+        append(attributeRelation.nodeName.str());
+        append(" SG_ ");
+        appendUnsigned(attributeRelation.messageId);
+        append(' ');
+        append(attributeRelation.signalName);
+        break;
+    }
+    append(' ');
+
+    /* Value */
+    appendAttributeValue(attributeRelation, false);
+}
+
+bool NetworkWriter::write(const Network & network) {
+    /* index attribute definitions by interned name */
+    attributeDefinitions.clear();
+    for (const auto & attributeDefinition : network.attributeDefinitions)
+        attributeDefinitions[Symbol(attributeDefinition.first)] = &attributeDefinition.second;
+
+    /* Version (VERSION) */
+    append("VERSION \"");
+    append(network.version);
+    append('"');
+    appendEndl();
+    appendEndl();
+
+    /* New Symbols (NS) */
+    appendEndl();
+    append("NS_ : ");
+    appendEndl();
+    for (const auto & newSymbol : network.newSymbols) {
+        append('\t');
+        append(newSymbol);
+        appendEndl();
+    }
+    appendEndl();
+
+    /* Bit Timing (BS) */
+    append("BS_:");
+    if (network.bitTiming.baudrate || network.bitTiming.btr1 || network.bitTiming.btr2) {
+        append(' ');
+        appendUnsigned(network.bitTiming.baudrate);
+        append(':');
+        appendUnsigned(network.bitTiming.btr1);
+        append(':');
+        appendUnsigned(network.bitTiming.btr2);
+    }
+    appendEndl();
+    appendEndl();
+
+    /* Nodes (BU) */
+    append("BU_:");
+    if (network.nodes.empty())
+        append(" Vector__XXX");
+    else
+        for (const auto & node : network.nodes) {
+            append(' ');
+            append(node.second.name);
+        }
+    appendEndl();
+
+    /* Value Tables (VAL_TABLE) */
+    for (const auto & valueTable : network.valueTables) {
+        append("VAL_TABLE_ ");
+        append(valueTable.second.name);
+        appendValueDescriptions(valueTable.second.valueDescriptions);
+    }
+    appendEndl();
+    appendEndl();
+
+    /* Messages (BO) */
+    for (const auto & message : network.messages)
+        writeMessage(message.second);
+
+    /* Message Transmitters (BO_TX_BU) */
+    for (const auto & message : network.messages) {
+        if (!message.second.transmitters.empty()) {
+            append("BO_TX_BU_ ");
+            appendUnsigned(message.second.id);
+            append(" :");
+            bool first = true;
+            for (const auto & transmitter : message.second.transmitters) {
+                if (first)
+                    first = false;
+                else
+                    append(',');
+                append(transmitter.str());
+            }
+            append(';');
+            appendEndl();
+        }
+    }
+    appendEndl();
+
+    /* Environment Variables (EV) */
+    for (const auto & environmentVariable : network.environmentVariables) {
+        appendEndl();
+        writeEnvironmentVariable(environmentVariable.second);
+    }
+
+    /* Environment Variable Data (ENVVAR_DATA) */
+    for (const auto & environmentVariable : network.environmentVariables) {
+        if (environmentVariable.second.type == EnvironmentVariable::Type::Data) {
+            append("ENVVAR_DATA_ ");
+            append(environmentVariable.second.name);
+            append(": ");
+            appendUnsigned(environmentVariable.second.dataSize);
+            append(';');
+            appendEndl();
+        }
+    }
+    appendEndl();
+
+    /* Comments (CM) */
+    if (!network.comment.empty()) {
+        append("CM_ \"");
+        append(network.comment);
+        append("\";");
+        appendEndl();
+    }
+    for (const auto & node : network.nodes) {
+        if (!node.second.comment.empty()) {
+            append("CM_ BU_ ");
+            append(node.second.name);
+            append(" \"");
+            append(node.second.comment);
+            append("\";");
+            appendEndl();
+        }
+    }
+    for (const auto & message : network.messages) {
+        if (!message.second.comment.empty()) {
+            append("CM_ BO_ ");
+            appendUnsigned(message.second.id);
+            append(" \"");
+            append(message.second.comment);
+            append("\";");
+            appendEndl();
+        }
+    }
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            if (!signal.second.comment.empty()) {
+                append("CM_ SG_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                append(" \"");
+                append(signal.second.comment);
+                append("\";");
+                appendEndl();
+            }
+        }
+    }
+    for (const auto & environmentVariable : network.environmentVariables) {
+        if (!environmentVariable.second.comment.empty()) {
+            append("CM_ EV_ ");
+            append(environmentVariable.second.name);
+            append(" \"");
+            append(environmentVariable.second.comment);
+            append("\";");
+            appendEndl();
+        }
+    }
+
+    /* Attribute Definitions (BA_DEF) and Attribute Definitions at Relations (BA_DEF_REL) */
+    for (const auto & attributeDefinition : network.attributeDefinitions)
+        writeAttributeDefinition(attributeDefinition.second);
+
+    /* Attribute Defaults (BA_DEF_DEF) and Attribute Defaults at Relations (BA_DEF_DEF_REL) */
+    for (const auto & attributeDefault : network.attributeDefaults) {
+        switch (attributeDefinition(attributeDefault.second.name).objectType) {
+        case AttributeObjectType::Network:
+        case AttributeObjectType::Node:
+        case AttributeObjectType::Message:
+        case AttributeObjectType::Signal:
+        case AttributeObjectType::EnvironmentVariable:
+            append("BA_DEF_DEF_ ");
+            break;
+        case AttributeObjectType::ControlUnitEnvironmentVariable:
+        case AttributeObjectType::NodeTxMessage:
+        case AttributeObjectType::NodeMappedRxSignal:
+            append("BA_DEF_DEF_REL_");
+            break;
+        }
+        append(" \"");
+        append(attributeDefault.second.name.str());
+        append("\" ");
+        appendAttributeValue(attributeDefault.second, true);
+    }
+
+    /* Attribute Values (BA) */
+    for (const auto & attributeValue : network.attributeValues) {
+        append("BA_ \"");
+        append(attributeValue.second.name.str());
+        append("\" ");
+        appendAttributeValue(attributeValue.second, false);
+    }
+    for (const auto & node : network.nodes) {
+        for (const auto & attributeValue : node.second.attributeValues) {
+            append("BA_ \"");
+            append(attributeValue.second.name.str());
+            append("\" BU_ ");
+            append(node.second.name);
+            append(' ');
+            appendAttributeValue(attributeValue.second, false);
+        }
+    }
+    for (const auto & message : network.messages) {
+        for (const auto & attributeValue : message.second.attributeValues) {
+            append("BA_ \"");
+            append(attributeValue.second.name.str());
+            append("\" BO_ ");
+            appendUnsigned(message.second.id);
+            append(' ');
+            appendAttributeValue(attributeValue.second, false);
+        }
+    }
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            for (const auto & attributeValue : signal.second.attributeValues) {
+                append("BA_ \"");
+                append(attributeValue.second.name.str());
+                append("\" SG_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                append(' ');
+                appendAttributeValue(attributeValue.second, false);
+            }
+        }
+    }
+    for (const auto & environmentVariable : network.environmentVariables) {
+        for (const auto & attributeValue : environmentVariable.second.attributeValues) {
+            append("BA_ \"");
+            append(attributeValue.second.name.str());
+            append("\" EV_ ");
+            append(environmentVariable.second.name);
+            append(' ');
+            appendAttributeValue(attributeValue.second, false);
+        }
+    }
+
+    /* Attribute Values at Relations (BA_REL) */
+    for (const auto & attributeRelationValue : network.attributeRelationValues)
+        writeAttributeRelation(attributeRelationValue.second);
+
+    /* Value Descriptions (VAL) */
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            if (!signal.second.valueDescriptions.empty()) {
+                append("VAL_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                appendValueDescriptions(signal.second.valueDescriptions);
+            }
+        }
+    }
+    for (const auto & environmentVariable : network.environmentVariables) {
+        if (!environmentVariable.second.valueDescriptions.empty()) {
+            append("VAL_ ");
+            append(environmentVariable.second.name);
+            appendValueDescriptions(environmentVariable.second.valueDescriptions);
+        }
+    }
+
+    /* Signal Type Refs (SGTYPE, obsolete) */
+    for (const auto & signalType : network.signalTypes) {
+        append("SGTYPE_ ");
+        append(signalType.second.name);
+        append(" : ");
+        appendUnsigned(signalType.second.size);
+        append('@');
+        append(char(signalType.second.byteOrder));
+        append(' ');
+        append(char(signalType.second.valueType));
+        append(' ');
+        appendDouble(signalType.second.defaultValue);
+        append(", ");
+        append(signalType.second.valueTable);
+        append(';');
+        appendEndl();
+    }
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            if (!signal.second.type.empty()) {
+                append("SGTYPE_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                append(" : ");
+                append(signal.second.type);
+                append(';');
+                appendEndl();
+            }
+        }
+    }
+
+    /* Signal Groups (SIG_GROUP) */
+    for (const auto & message : network.messages) {
+        for (const auto & signalGroup : message.second.signalGroups) {
+            append("SIG_GROUP_ ");
+            appendUnsigned(signalGroup.second.messageId);
+            append(' ');
+            append(signalGroup.second.name);
+            append(' ');
+            appendUnsigned(signalGroup.second.repetitions);
+            bool first = true;
+            for (const auto & signal : signalGroup.second.signals) {
+                if (first)
+                    first = false;
+                else
+                    append(',');
+                append(signal);
+            }
+            append(';');
+            appendEndl();
+        }
+    }
+
+    /* Signal Extended Value Types (SIG_VALTYPE, obsolete) */
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            if (signal.second.extendedValueType != Signal::ExtendedValueType::Undefined) {
+                append("SIG_VALTYPE_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                append(" : ");
+                append(char(signal.second.extendedValueType));
+                append(';');
+                appendEndl();
+            }
+        }
+    }
+
+    /* Extended Multiplexors (SG_MUL_VAL) */
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            for (const auto & extendedMultiplexor : signal.second.extendedMultiplexors) {
+                append("SG_MUL_VAL_ ");
+                appendUnsigned(message.second.id);
+                append(' ');
+                append(signal.second.name);
+                append(' ');
+                append(extendedMultiplexor.second.switchName);
+                bool first = true;
+                for (const auto & valueRange : extendedMultiplexor.second.valueRanges) {
+                    if (first)
+                        first = false;
+                    else
+                        append(", ");
+                    appendUnsigned(valueRange.first);
+                    append('-');
+                    appendUnsigned(valueRange.second);
+                }
+                append(';');
+                appendEndl();
+            }
+        }
+    }
+
+    appendEndl();
+
+    return flush();
+}
+
+bool saveFile(const Network & network, const std::string & fileName) {
+#if defined(_WIN32)
+    const int fileDescriptor = _open(fileName.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    const int fileDescriptor = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+#endif
+    if (fileDescriptor < 0)
+        return false;
+
+    NetworkWriter writer(NetworkWriter::fileDescriptorSink(fileDescriptor));
+    bool written = writer.write(network);
+#if defined(_WIN32)
+    written = (_close(fileDescriptor) == 0) && written;
+#else
+    written = (::close(fileDescriptor) == 0) && written;
+#endif
+    return written;
+}
+
+}
+}
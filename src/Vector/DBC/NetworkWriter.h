@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+#include <Vector/DBC/Attribute.h>
+#include <Vector/DBC/AttributeDefinition.h>
+#include <Vector/DBC/AttributeRelation.h>
+#include <Vector/DBC/AttributeValueType.h>
+#include <Vector/DBC/EnvironmentVariable.h>
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/Signal.h>
+#include <Vector/DBC/Symbol.h>
+#include <Vector/DBC/ValueDescriptions.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Network Writer
+ *
+ * Writes a network in DBC format, also for
+ * operator<<(std::ostream &, const Network &). Instead of many small
+ * stream insertions, it formats into a growable buffer with own number
+ * conversions, and passes the buffer in large blocks to a sink, e.g. a
+ * file descriptor or stream. Attribute definitions are indexed once per
+ * network by the address of their interned name, so each attribute value
+ * needs one pointer hash lookup instead of a string comparing map lookup.
+ *
+ * Without sink, the complete output stays in the buffer.
+ */
+class VECTOR_DBC_EXPORT NetworkWriter {
+  public:
+    /**
+     * Sink, which gets the output in blocks.
+     * It returns false on errors, which stops further output.
+     */
+    using Sink = std::function<bool(const char * data, std::size_t size)>;
+
+    /** Create writer, which keeps the output in its buffer */
+    NetworkWriter() = default;
+
+    /**
+     * @brief Create writer with sink
+     * @param[in] sink Sink
+     * @param[in] blockSize Buffer size, from which on the buffer is passed to the sink
+     */
+    explicit NetworkWriter(Sink sink, std::size_t blockSize = 0x10000);
+
+    /**
+     * @brief Create sink writing to a file descriptor
+     * @param[in] fileDescriptor File descriptor (not closed by the sink)
+     * @return Sink
+     */
+    static Sink fileDescriptorSink(int fileDescriptor);
+
+    /**
+     * @brief Create sink writing to a stream
+     * @param[in] os Output stream (must outlive the sink)
+     * @return Sink
+     */
+    static Sink streamSink(std::ostream & os);
+
+    /**
+     * @brief Write network
+     * @param[in] network Network
+     * @return true if no sink error occurred
+     *
+     * The output is flushed to the sink at the end.
+     */
+    bool write(const Network & network);
+
+    /**
+     * @brief Pass buffered output to sink
+     * @return true if no sink error occurred
+     */
+    bool flush();
+
+    /**
+     * @brief Get buffered output
+     * @return Output, which wasn't passed to a sink yet
+     */
+    const std::string & buffer() const {
+        return output;
+    }
+
+    /**
+     * @brief Clear buffered output
+     */
+    void clear() {
+        output.clear();
+    }
+
+  private:
+    /** output buffer */
+    std::string output {};
+
+    /** sink (empty to keep all output in buffer) */
+    Sink sink {};
+
+    /** buffer size, from which on the buffer is passed to the sink */
+    std::size_t blockSize {};
+
+    /** sink error occurred */
+    bool failed {};
+
+    /** attribute definitions of the network being written */
+    std::unordered_map<Symbol, const AttributeDefinition *> attributeDefinitions {};
+
+    /**
+     * @brief Append string
+     * @param[in] data Data
+     * @param[in] size Size
+     */
+    void append(const char * data, std::size_t size) {
+        output.append(data, size);
+    }
+
+    /**
+     * @brief Append string literal
+     * @param[in] literal String literal
+     */
+    template<std::size_t N>
+    void append(const char (&literal)[N]) {
+        output.append(literal, N - 1);
+    }
+
+    /**
+     * @brief Append string
+     * @param[in] string String
+     */
+    void append(const std::string & string) {
+        output.append(string);
+    }
+
+    /**
+     * @brief Append character
+     * @param[in] character Character
+     */
+    void append(char character) {
+        output.push_back(character);
+    }
+
+    /**
+     * @brief Append line end and flush full buffer
+     */
+    void appendEndl();
+
+    /**
+     * @brief Append unsigned integer in decimal
+     * @param[in] value Value
+     */
+    void appendUnsigned(uint64_t value);
+
+    /**
+     * @brief Append signed integer in decimal
+     * @param[in] value Value
+     */
+    void appendSigned(int64_t value);
+
+    /**
+     * @brief Append unsigned integer in lower case hexadecimal
+     * @param[in] value Value
+     */
+    void appendHex(uint32_t value);
+
+    /**
+     * @brief Append floating point number with 16 significant digits
+     * @param[in] value Value
+     */
+    void appendDouble(double value);
+
+    /**
+     * @brief Append value descriptions (VAL_, VAL_TABLE_)
+     * @param[in] valueDescriptions Value Descriptions
+     */
+    void appendValueDescriptions(const ValueDescriptions & valueDescriptions);
+
+    /**
+     * @brief Get attribute definition
+     * @param[in] name Attribute name
+     * @return Attribute definition
+     * @throws std::out_of_range if attribute is not defined
+     */
+    const AttributeDefinition & attributeDefinition(const Symbol & name) const;
+
+    /**
+     * @brief Append attribute value, followed by semicolon and line end
+     * @param[in] attribute Attribute
+     * @param[in] isDefault Attribute default (BA_DEF_DEF), which has enum values as string
+     */
+    void appendAttributeValue(const Attribute & attribute, bool isDefault);
+
+    /**
+     * @brief Write message (BO) with signals (SG)
+     * @param[in] message Message
+     */
+    void writeMessage(const Message & message);
+
+    /**
+     * @brief Write signal (SG)
+     * @param[in] signal Signal
+     */
+    void writeSignal(const Signal & signal);
+
+    /**
+     * @brief Write environment variable (EV)
+     * @param[in] environmentVariable Environment Variable
+     */
+    void writeEnvironmentVariable(const EnvironmentVariable & environmentVariable);
+
+    /**
+     * @brief Write attribute definition (BA_DEF, BA_DEF_REL)
+     * @param[in] attributeDefinition Attribute Definition
+     */
+    void writeAttributeDefinition(const AttributeDefinition & attributeDefinition);
+
+    /**
+     * @brief Write attribute relation value (BA_REL)
+     * @param[in] attributeRelation Attribute Relation
+     */
+    void writeAttributeRelation(const AttributeRelation & attributeRelation);
+};
+
+/**
+ * @brief Save network as DBC file
+ * @param[in] network Network
+ * @param[in] fileName File name
+ * @return true if the file was written
+ *
+ * This uses NetworkWriter and writes the same as operator<<.
+ */
+VECTOR_DBC_EXPORT bool saveFile(const Network & network, const std::string & fileName);
+
+}
+}
@@ -26,7 +26,9 @@
 #include <map>
 #include <string>
 
+#include <Vector/DBC/Arena.h>
 #include <Vector/DBC/Attribute.h>
+#include <Vector/DBC/Symbol.h>
 
 #include <Vector/DBC/vector_dbc_export.h>
 
@@ -35,6 +37,8 @@ namespace DBC {
 
 /**
  * Node (BU)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT Node {
     /** Name */
@@ -44,7 +48,7 @@ struct VECTOR_DBC_EXPORT Node {
     std::string comment {};
 
     /** Attribute Values (BA) */
-    std::map<std::string, Attribute> attributeValues {};
+    ArenaMap<Symbol, Attribute> attributeValues {};
 };
 
 }
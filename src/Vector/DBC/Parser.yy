@@ -32,6 +32,7 @@ class Network;
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Vector/DBC/Network.h>
@@ -67,7 +68,7 @@ static double stod(const std::string & str)
 %type <int32_t> signed_integer
 %type <double> double
 %type <std::string> char_string
-%type <std::vector<std::string>> char_strings
+%type <ArenaVector<std::string>> char_strings
 %type <std::string> dbc_identifier
 
     /* 3 Structure of the DBC File */
@@ -76,7 +77,7 @@ static double stod(const std::string & str)
 %token VERSION NS
 %token <std::string> NS_VALUE
 %type <std::string> candb_version_string
-%type <std::vector<std::string>> new_symbol_values
+%type <ArenaVector<std::string>> new_symbol_values
 
     /* 5 Bit Timing Definition */
 %token BS
@@ -94,7 +95,7 @@ static double stod(const std::string & str)
 %type <std::string> value_table_name
 
     /* 7.1 Value Descriptions (Value Encodings) */
-%type <std::map<uint32_t, std::string>> value_encoding_descriptions
+%type <ValueDescriptions> value_encoding_descriptions
 %type <std::pair<uint32_t, std::string>> value_encoding_description
 
     /* 8 Message Definitions */
@@ -103,16 +104,16 @@ static double stod(const std::string & str)
 %type <uint32_t> message_id
 %type <std::string> message_name
 %type <uint32_t> message_size
-%type <std::string> transmitter
+%type <Symbol> transmitter
 
     /* 8.1 Pseudo-message */
 
     /* 8.2 Signal Definitions */
 %token SG LOWER_M UPPER_M SIG_VALTYPE
-%type <std::map<std::string, Signal>> signals
+%type <ArenaMap<std::string, Signal>> signals
 %type <Signal> signal
 %type <std::string> signal_name
-%type <std::set<std::string>> signal_names
+%type <ArenaSet<std::string>> signal_names
 %type <std::string> multiplexer_indicator
 //%type <uint32_t> multiplexer_switch_value
 %type <uint32_t> start_bit
@@ -124,13 +125,13 @@ static double stod(const std::string & str)
 %type <double> minimum
 %type <double> maximum
 %type <std::string> unit
-%type <std::set<std::string>> receivers
-%type <std::string> receiver
+%type <ArenaSet<Symbol>> receivers
+%type <Symbol> receiver
 %type <Signal::ExtendedValueType> signal_extended_value_type_type
 
     /* 8.3 Definition of Message Transmitters */
 %token BO_TX_BU
-%type <std::set<std::string>> transmitters
+%type <ArenaSet<Symbol>> transmitters
 
     /* 8.4 Signal Value Descriptions (Value Encodings) */
 %token VAL
@@ -145,8 +146,8 @@ static double stod(const std::string & str)
 %type <double> initial_value
 %type <uint32_t> ev_id
 %type <uint16_t> access_type
-%type <std::set<std::string>> access_nodes
-%type <std::string> access_node
+%type <ArenaSet<Symbol>> access_nodes
+%type <Symbol> access_node
 %type <uint32_t> data_size
 
     /* 9.1 Environment Variable Value Descriptions */
@@ -167,7 +168,7 @@ static double stod(const std::string & str)
 %token BA_DEF INT HEX FLOAT STRING ENUM
 %token BA_DEF_REL BU_EV_REL BU_BO_REL BU_SG_REL
 %type <AttributeObjectType> object_type
-%type <std::string> attribute_name
+%type <Symbol> attribute_name
 %type <AttributeValueType> attribute_value_type
 
     /* Attribute Defaults */
@@ -183,7 +184,7 @@ static double stod(const std::string & str)
 %token SG_MUL_VAL
 %type <std::string> multiplexed_signal_name
 %type <std::string> multiplexor_switch_name
-%type <std::set<ExtendedMultiplexor::ValueRange>> multiplexor_value_ranges
+%type <ArenaSet<ExtendedMultiplexor::ValueRange>> multiplexor_value_ranges
 %type <ExtendedMultiplexor::ValueRange> multiplexor_value_range
 
     /* Punctuators */
@@ -196,8 +197,16 @@ static double stod(const std::string & str)
     /* match end of file */
 %token END 0
 
+    /* start of a fragment (parallel loading) */
+%token MESSAGES_FRAGMENT
+
 %%
 
+start
+        : network
+        | MESSAGES_FRAGMENT messages        // BO_ / SG_ only
+        ;
+
     /* 3 Structure of the DBC File */
 network
         : version                           // VERSION
@@ -243,8 +252,8 @@ char_string
         : CHAR_STRING { $$ = $1; }
         ;
 char_strings
-        : CHAR_STRING { $$ = std::vector<std::string>(); $$.push_back($1); }
-        | char_strings COMMA CHAR_STRING { $$ = $1; $$.push_back($3); }
+        : CHAR_STRING { $$ = ArenaVector<std::string>(); $$.push_back($1); }
+        | char_strings COMMA CHAR_STRING { $$ = std::move($1); $$.push_back($3); }
         ;
 dbc_identifier
         : DBC_IDENTIFIER { $$ = $1; }
@@ -260,11 +269,11 @@ candb_version_string
 new_symbols
         : %empty
         | NS COLON EOL
-          new_symbol_values { network->newSymbols = $4; }
+          new_symbol_values { network->newSymbols = std::move($4); }
         ;
 new_symbol_values
-        : %empty { $$ = std::vector<std::string>(); }
-        | new_symbol_values NS_VALUE EOL { $$ = $1; $$.push_back($2); }
+        : %empty { $$ = ArenaVector<std::string>(); }
+        | new_symbol_values NS_VALUE EOL { $$ = std::move($1); $$.push_back($2); }
         ;
 
     /* 5 Bit Timing Definition */
@@ -302,13 +311,13 @@ node_name
     /* 7 Value Table Definitions */
 value_tables
         : %empty
-        | value_tables value_table { network->valueTables[$value_table.name] = $value_table; }
+        | value_tables value_table { network->valueTables[$value_table.name] = std::move($value_table); }
         ;
 value_table
         : VAL_TABLE value_table_name value_encoding_descriptions SEMICOLON EOL {
               $$ = ValueTable();
               $$.name = $value_table_name;
-              $$.valueDescriptions = $value_encoding_descriptions;
+              $$.valueDescriptions = std::move($value_encoding_descriptions);
           }
         ;
 value_table_name
@@ -317,8 +326,8 @@ value_table_name
 
     /* 7.1 Value Descriptions (Value Encodings) */
 value_encoding_descriptions
-        : %empty { $$ = std::map<uint32_t, std::string>(); }
-        | value_encoding_descriptions value_encoding_description { $$ = $1; $$.insert($2); }
+        : %empty { $$ = ValueDescriptions(); }
+        | value_encoding_descriptions value_encoding_description { $$ = std::move($1); $$.insert($2); }
         ;
 value_encoding_description
         : unsigned_integer char_string { $$ = std::make_pair($1, $2); }
@@ -327,7 +336,7 @@ value_encoding_description
     /* 8 Message Definitions */
 messages
         : %empty
-        | messages message { network->messages[$message.id] = $message; }
+        | messages message { network->messages[$message.id] = std::move($message); }
         ;
 message
         : BO message_id message_name COLON message_size transmitter EOL signals {
@@ -336,7 +345,7 @@ message
               $$.name = $message_name;
               $$.size = $message_size;
               $$.transmitter = $transmitter;
-              $$.signals = $signals;
+              $$.signals = std::move($signals);
           }
         ;
 message_id
@@ -357,8 +366,8 @@ transmitter
 
     /* 8.2 Signal Definitions */
 signals
-        : %empty { $$ = std::map<std::string, Signal>(); }
-        | signals signal { $$ = $1; $$[$2.name] = $2; }
+        : %empty { $$ = ArenaMap<std::string, Signal>(); }
+        | signals signal { $$ = std::move($1); $$[$2.name] = std::move($2); }
         ;
 signal
         : SG signal_name multiplexer_indicator COLON start_bit VERTICAL_BAR signal_size AT byte_order value_type OPEN_PARENTHESIS factor COMMA offset CLOSE_PARENTHESIS OPEN_BRACKET minimum VERTICAL_BAR maximum CLOSE_BRACKET unit receivers EOL {
@@ -380,15 +389,15 @@ signal
               $$.minimum = $minimum;
               $$.maximum = $maximum;
               $$.unit = $unit;
-              $$.receivers = $receivers;
+              $$.receivers = std::move($receivers);
           }
         ;
 signal_name
         : dbc_identifier { $$ = $1; }
         ;
 signal_names
-        : %empty { $$ = std::set<std::string>(); }
-        | signal_names signal_name { $$ = $1; $$.insert($2); }
+        : %empty { $$ = ArenaSet<std::string>(); }
+        | signal_names signal_name { $$ = std::move($1); $$.insert($2); }
         ;
 multiplexer_indicator
         : %empty { $$ = ""; }
@@ -431,13 +440,13 @@ unit
         ;
 receivers
         : receiver {
-              $$ = std::set<std::string>();
+              $$ = ArenaSet<Symbol>();
               if (!$receiver.empty()) {
                   $$.insert($receiver);
               }
           }
         | receivers COMMA receiver {
-              $$ = $1;
+              $$ = std::move($1);
               if (!$receiver.empty()) {
                   $$.insert($receiver);
               }
@@ -478,11 +487,11 @@ message_transmitters
         | message_transmitters message_transmitter
         ;
 message_transmitter
-        : BO_TX_BU message_id COLON transmitters SEMICOLON EOL { network->messages[$message_id].transmitters = $transmitters; }
+        : BO_TX_BU message_id COLON transmitters SEMICOLON EOL { network->messages[$message_id].transmitters = std::move($transmitters); }
         ;
 transmitters
-        : transmitter { $$ = std::set<std::string>(); $$.insert($1); }
-        | transmitters COMMA transmitter { $$ = $1; $$.insert($3); }
+        : transmitter { $$ = ArenaSet<Symbol>(); $$.insert($1); }
+        | transmitters COMMA transmitter { $$ = std::move($1); $$.insert($3); }
         ;
 
     /* 8.4 Signal Value Descriptions (Value Encodings) */
@@ -493,7 +502,7 @@ value_descriptions
         ;
 value_descriptions_for_signal
         : VAL message_id signal_name value_encoding_descriptions SEMICOLON EOL {
-              network->messages[$message_id].signals[$signal_name].valueDescriptions = $value_encoding_descriptions;
+              network->messages[$message_id].signals[$signal_name].valueDescriptions = std::move($value_encoding_descriptions);
           }
         ;
 
@@ -529,7 +538,7 @@ environment_variable
                       environmentVariable.accessType = EnvironmentVariable::AccessType::ReadWrite;
                       break;
               }
-              environmentVariable.accessNodes = $access_nodes;
+              environmentVariable.accessNodes = std::move($access_nodes);
           }
         ;
 env_var_name
@@ -560,13 +569,13 @@ access_type
         ;
 access_nodes
         : access_node {
-              $$ = std::set<std::string>();
+              $$ = ArenaSet<Symbol>();
               if (!$access_node.empty()) {
                   $$.insert($access_node);
               }
           }
         | access_nodes COMMA access_node {
-              $$ = $1;
+              $$ = std::move($1);
               if (!$access_node.empty()) {
                   $$.insert($access_node);
               }
@@ -593,7 +602,7 @@ data_size
     /* 9.1 Environment Variable Value Descriptions */
 value_descriptions_for_env_var
         : VAL env_var_name value_encoding_descriptions SEMICOLON EOL {
-              network->environmentVariables[$env_var_name].valueDescriptions = $value_encoding_descriptions;
+              network->environmentVariables[$env_var_name].valueDescriptions = std::move($value_encoding_descriptions);
           }
         ;
 
@@ -646,7 +655,7 @@ signal_group
               signalGroup.messageId = $message_id;
               signalGroup.name = $signal_group_name;
               signalGroup.repetitions = $repetitions;
-              signalGroup.signals = $signal_names;
+              signalGroup.signals = std::move($signal_names);
           }
         ;
 signal_group_name
@@ -729,7 +738,7 @@ attribute_value_type
         | ENUM char_strings {
               $$ = AttributeValueType();
               $$.type = AttributeValueType::Type::Enum;
-              $$.enumValues = $char_strings;
+              $$.enumValues = std::move($char_strings);
           }
         ;
 
@@ -1001,7 +1010,7 @@ multiplexed_signal
         : SG_MUL_VAL message_id multiplexed_signal_name multiplexor_switch_name multiplexor_value_ranges SEMICOLON EOL {
               ExtendedMultiplexor & extendedMultiplexor = network->messages[$message_id].signals[$multiplexed_signal_name].extendedMultiplexors[$multiplexor_switch_name];
               extendedMultiplexor.switchName = $multiplexor_switch_name;
-              extendedMultiplexor.valueRanges = $multiplexor_value_ranges;
+              extendedMultiplexor.valueRanges = std::move($multiplexor_value_ranges);
           }
         ;
 multiplexed_signal_name
@@ -1011,16 +1020,26 @@ multiplexor_switch_name
         : dbc_identifier { $$ = $1; }
         ;
 multiplexor_value_ranges
-        : %empty { $$ = std::set<ExtendedMultiplexor::ValueRange>(); }
-        | multiplexor_value_ranges multiplexor_value_range { $$ = $1; $$.insert($2); }
+        : multiplexor_value_range { $$ = ArenaSet<ExtendedMultiplexor::ValueRange>(); $$.insert($1); }
+        | multiplexor_value_ranges COMMA multiplexor_value_range { $$ = std::move($1); $$.insert($3); }
         ;
 multiplexor_value_range
         : unsigned_integer MINUS unsigned_integer { $$ = std::make_pair($1, $3); }
+        | unsigned_integer SIGNED_INTEGER {
+              /* "0-3" is scanned as unsigned and signed integer */
+              if ($2[0] != '-') {
+                  error(@2, "expected value range");
+                  YYERROR;
+              }
+              $$ = std::make_pair($1, static_cast<uint32_t>(std::stoul($2.substr(1))));
+          }
         ;
 
 %%
 
 void Vector::DBC::Parser::error(const location_type & location, const std::string & message)
 {
-    std::cerr << "Parse error at " << location << ": " << message << std::endl;
+    if (scanner->reportErrors) {
+        std::cerr << "Parse error at " << location << ": " << message << std::endl;
+    }
 }
@@ -0,0 +1,465 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/Scanner.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace Vector {
+namespace DBC {
+
+namespace {
+
+/** keyword token constructor */
+using KeywordConstructor = Parser::symbol_type (*)(const Parser::location_type & loc);
+
+/** keyword */
+struct Keyword {
+    /** name */
+    const char * name;
+
+    /** token constructor */
+    KeywordConstructor make;
+
+    /** length of name */
+    std::size_t length;
+};
+
+/** size of the keyword table (power of two, see keywordHash) */
+constexpr std::size_t keywordTableSize = 128;
+
+/** length of the longest keyword */
+constexpr std::size_t maximumKeywordLength = 21;
+
+/**
+ * @brief Perfect hash of the keywords
+ * @param[in] text Identifier
+ * @param[in] length Length of identifier (at least 1)
+ * @return Slot in keyword table
+ *
+ * The length and five characters of the identifier are combined into
+ * one word, which a multiplicative hash maps onto the table. The
+ * multiplier was chosen, so that no two keywords share a slot.
+ */
+std::size_t keywordHash(const char * text, std::size_t length) {
+    const unsigned char * c = reinterpret_cast<const unsigned char *>(text);
+    const std::size_t beforeLast = (length < 2) ? 0 : (length - 2);
+    const std::size_t beforeMiddle = (length < 2) ? 0 : (length / 2 - 1);
+    const uint64_t key =
+        (static_cast<uint64_t>(length)) |
+        (static_cast<uint64_t>(c[0]) << 8) |
+        (static_cast<uint64_t>(c[length - 1]) << 16) |
+        (static_cast<uint64_t>(c[beforeLast]) << 24) |
+        (static_cast<uint64_t>(c[length / 2]) << 32) |
+        (static_cast<uint64_t>(c[beforeMiddle]) << 40);
+    return static_cast<std::size_t>((key * UINT64_C(0xf8ebdbe245ea4611)) >> 57);
+}
+
+#define KEYWORD(name, token) \
+    { name, [](const Parser::location_type & loc) { return Parser::make_##token(loc); }, sizeof(name) - 1 }
+
+/** keyword table */
+struct KeywordTable {
+    KeywordTable() : slots() {
+        static const Keyword keywords[] = {
+            /* 4 Version and New Symbol Specification */
+            KEYWORD("VERSION", VERSION),
+            KEYWORD("NS_", NS),
+
+            /* 5 Bit Timing Definition */
+            KEYWORD("BS_", BS),
+
+            /* 6 Node Definitions */
+            KEYWORD("BU_", BU),
+
+            /* 7 Value Table Definitions */
+            KEYWORD("VAL_TABLE_", VAL_TABLE),
+
+            /* 8 Message Definitions */
+            KEYWORD("BO_", BO),
+            KEYWORD("Vector__XXX", VECTOR_XXX),
+
+            /* 8.2 Signal Definitions */
+            KEYWORD("SG_", SG),
+            KEYWORD("m", LOWER_M),
+            KEYWORD("M", UPPER_M),
+            KEYWORD("SIG_VALTYPE_", SIG_VALTYPE),
+
+            /* 8.3 Definition of Message Transmitters */
+            KEYWORD("BO_TX_BU_", BO_TX_BU),
+
+            /* 8.4 Signal Value Descriptions (Value Encodings) */
+            KEYWORD("VAL_", VAL),
+
+            /* 9 Environment Variable Definitions */
+            KEYWORD("EV_", EV),
+            KEYWORD("DUMMY_NODE_VECTOR0", DUMMY_NODE_VECTOR0),
+            KEYWORD("DUMMY_NODE_VECTOR1", DUMMY_NODE_VECTOR1),
+            KEYWORD("DUMMY_NODE_VECTOR2", DUMMY_NODE_VECTOR2),
+            KEYWORD("DUMMY_NODE_VECTOR3", DUMMY_NODE_VECTOR3),
+            KEYWORD("DUMMY_NODE_VECTOR8000", DUMMY_NODE_VECTOR8000),
+            KEYWORD("DUMMY_NODE_VECTOR8001", DUMMY_NODE_VECTOR8001),
+            KEYWORD("DUMMY_NODE_VECTOR8002", DUMMY_NODE_VECTOR8002),
+            KEYWORD("DUMMY_NODE_VECTOR8003", DUMMY_NODE_VECTOR8003),
+            KEYWORD("ENVVAR_DATA_", ENVVAR_DATA),
+
+            /* 10 Signal Type and Signal Group Definitions */
+            KEYWORD("SGTYPE_", SGTYPE),
+            KEYWORD("SIG_GROUP_", SIG_GROUP),
+
+            /* 11 Comment Definitions */
+            KEYWORD("CM_", CM),
+
+            /* 12.1 Attribute Definitions */
+            KEYWORD("BA_DEF_", BA_DEF),
+            KEYWORD("INT", INT),
+            KEYWORD("HEX", HEX),
+            KEYWORD("FLOAT", FLOAT),
+            KEYWORD("STRING", STRING),
+            KEYWORD("ENUM", ENUM),
+            KEYWORD("BA_DEF_REL_", BA_DEF_REL),
+            KEYWORD("BU_EV_REL_", BU_EV_REL),
+            KEYWORD("BU_BO_REL_", BU_BO_REL),
+            KEYWORD("BU_SG_REL_", BU_SG_REL),
+
+            /* Attribute Defaults */
+            KEYWORD("BA_DEF_DEF_", BA_DEF_DEF),
+            KEYWORD("BA_DEF_DEF_REL_", BA_DEF_DEF_REL),
+
+            /* 12.2 Attribute Values */
+            KEYWORD("BA_", BA),
+            KEYWORD("BA_REL_", BA_REL),
+
+            /* 13 Extended Multiplexing */
+            KEYWORD("SG_MUL_VAL_", SG_MUL_VAL),
+        };
+
+        for (const Keyword & keyword : keywords) {
+            Keyword & slot = slots[keywordHash(keyword.name, keyword.length)];
+            assert(slot.name == nullptr);
+            slot = keyword;
+        }
+    }
+
+    /** slots */
+    Keyword slots[keywordTableSize];
+};
+
+#undef KEYWORD
+
+/**
+ * @brief Find keyword
+ * @param[in] text Identifier
+ * @param[in] length Length of identifier (at least 1)
+ * @return Keyword or nullptr
+ */
+const Keyword * findKeyword(const char * text, std::size_t length) {
+    static const KeywordTable keywordTable;
+
+    if (length > maximumKeywordLength)
+        return nullptr;
+    const Keyword & keyword = keywordTable.slots[keywordHash(text, length)];
+    if ((keyword.length != length) || (std::memcmp(keyword.name, text, length) != 0))
+        return nullptr;
+    return &keyword;
+}
+
+/** [0-9] */
+inline bool isDigit(char c) {
+    return (c >= '0') && (c <= '9');
+}
+
+/** [_a-zA-Z] */
+inline bool isNonDigit(char c) {
+    return (c == '_') || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+}
+
+/** [ \r\n] */
+inline bool isLineSpace(char c) {
+    return (c == ' ') || (c == '\r') || (c == '\n');
+}
+
+}
+
+Scanner::Scanner(std::istream & istream) :
+    location(),
+    reportErrors(true),
+    unreportedErrors(0),
+    buffer(),
+    current(nullptr),
+    end(nullptr),
+    newSymbols(false),
+    messagesFragment(false)
+{
+    /* read the complete input */
+    std::size_t size = 0;
+    for (;;) {
+        const std::size_t increment = std::max<std::size_t>(size, 0x10000);
+        buffer.resize(size + increment);
+        istream.read(&buffer[size], static_cast<std::streamsize>(increment));
+        size += static_cast<std::size_t>(istream.gcount());
+        if (!istream)
+            break;
+    }
+    buffer.resize(size);
+
+    current = buffer.data();
+    end = current + size;
+}
+
+Scanner::Scanner(const char * data, std::size_t size) :
+    location(),
+    reportErrors(true),
+    unreportedErrors(0),
+    buffer(),
+    current(data),
+    end(data + size),
+    newSymbols(false),
+    messagesFragment(false)
+{
+}
+
+void Scanner::startMessagesFragment() {
+    messagesFragment = true;
+}
+
+Parser::symbol_type Scanner::yylex(const Parser::location_type & loc) {
+    /* select fragment start rule */
+    if (messagesFragment) {
+        messagesFragment = false;
+        return Parser::make_MESSAGES_FRAGMENT(loc);
+    }
+
+    for (;;) {
+        /* match end of file */
+        if (current == end)
+            return Parser::make_END(loc);
+
+        const char * text = current;
+        const char * next = current + 1;
+        const char c = *text;
+
+        /* end of line: ([ ]*[\r\n]+)+ */
+        if (isLineSpace(c)) {
+            const char * p = text;
+            const char * lineEnd = nullptr;
+            for (; (p != end) && isLineSpace(*p); ++p)
+                if (*p != ' ')
+                    lineEnd = p + 1;
+            if (lineEnd != nullptr) {
+                stepLines(lineEnd);
+                return Parser::make_EOL(loc);
+            }
+
+            /* whitespace: a run of spaces */
+            step(p);
+            continue;
+        }
+
+        /* whitespace */
+        if (c == '\t') {
+            step(next);
+            continue;
+        }
+
+        if (newSymbols) {
+            /* new symbol values, which end with BS_ */
+            if (isNonDigit(c)) {
+                while ((next != end) && isNonDigit(*next))
+                    ++next;
+                if ((next - text == 3) && (std::memcmp(text, "BS_", 3) == 0)) {
+                    newSymbols = false;
+                    step(next);
+                    return Parser::make_BS(loc);
+                }
+                std::string value(text, next);
+                step(next);
+                return Parser::make_NS_VALUE(std::move(value), loc);
+            }
+            if (c == ':') {
+                step(next);
+                return Parser::make_COLON(loc);
+            }
+        } else {
+            /* keywords and identifiers */
+            if (isNonDigit(c)) {
+                while ((next != end) && (isNonDigit(*next) || isDigit(*next)))
+                    ++next;
+                const std::size_t length = static_cast<std::size_t>(next - text);
+                const Keyword * keyword = findKeyword(text, length);
+                if (keyword != nullptr) {
+                    if ((length == 3) && (std::memcmp(text, "NS_", 3) == 0))
+                        newSymbols = true;
+                    step(next);
+                    return keyword->make(loc);
+                }
+                std::string value(text, next);
+                step(next);
+                return Parser::make_DBC_IDENTIFIER(std::move(value), loc);
+            }
+
+            /* numbers: {DIGIT}+, [-+]?{DIGIT}+, [-+]?{DIGIT}*"."?{DIGIT}+{EXPONENT_PART}? */
+            if (isDigit(c) || (c == '-') || (c == '+') || (c == '.')) {
+                const bool hasSign = (c == '-') || (c == '+');
+                next = hasSign ? (text + 1) : text;
+                const char * digits = next;
+                while ((next != end) && isDigit(*next))
+                    ++next;
+                const bool hasInteger = (next != digits);
+                bool isDouble = false;
+                if ((next != end) && (*next == '.') && (next + 1 != end) && isDigit(next[1])) {
+                    next += 2;
+                    while ((next != end) && isDigit(*next))
+                        ++next;
+                    isDouble = true;
+                }
+                if (hasInteger || isDouble) {
+                    if ((next != end) && ((*next == 'e') || (*next == 'E'))) {
+                        const char * exponent = next + 1;
+                        if ((exponent != end) && ((*exponent == '-') || (*exponent == '+')))
+                            ++exponent;
+                        if ((exponent != end) && isDigit(*exponent)) {
+                            while ((exponent != end) && isDigit(*exponent))
+                                ++exponent;
+                            next = exponent;
+                            isDouble = true;
+                        }
+                    }
+                    std::string value(text, next);
+                    step(next);
+                    if (isDouble)
+                        return Parser::make_DOUBLE(std::move(value), loc);
+                    if (hasSign)
+                        return Parser::make_SIGNED_INTEGER(std::move(value), loc);
+                    return Parser::make_UNSIGNED_INTEGER(std::move(value), loc);
+                }
+                next = text + 1;
+            }
+
+            /* strings: \"(\\.|[^\\"])*\" */
+            if (c == '"') {
+                const char * p = text + 1;
+                while ((p != end) && (*p != '"')) {
+                    if (*p == '\\') {
+                        if ((p + 1 == end) || (p[1] == '\n'))
+                            break;
+                        ++p;
+                    }
+                    ++p;
+                }
+                if ((p != end) && (*p == '"')) {
+                    std::string value(text + 1, p);
+                    stepLines(p + 1);
+                    return Parser::make_CHAR_STRING(std::move(value), loc);
+                }
+            }
+
+            /* comments: "//".*[\r\n]+ */
+            if ((c == '/') && (next != end) && (*next == '/')) {
+                const char * lineEnd = static_cast<const char *>(std::memchr(next, '\n', static_cast<std::size_t>(end - next)));
+                if (lineEnd != nullptr) {
+                    next = lineEnd + 1;
+                    while ((next != end) && ((*next == '\r') || (*next == '\n')))
+                        ++next;
+                    stepLines(next);
+                    continue;
+                }
+            }
+
+            /* punctuators */
+            switch (c) {
+            case '[': // left square bracket
+                step(next);
+                return Parser::make_OPEN_BRACKET(loc);
+            case ']': // right square bracket
+                step(next);
+                return Parser::make_CLOSE_BRACKET(loc);
+            case '(': // left parenthesis
+                step(next);
+                return Parser::make_OPEN_PARENTHESIS(loc);
+            case ')': // right parenthesis
+                step(next);
+                return Parser::make_CLOSE_PARENTHESIS(loc);
+            case '+': // plus sign
+                step(next);
+                return Parser::make_PLUS(loc);
+            case '-': // hyphen-minus
+                step(next);
+                return Parser::make_MINUS(loc);
+            case '|': // vertical bar
+                step(next);
+                return Parser::make_VERTICAL_BAR(loc);
+            case ':': // colon
+                step(next);
+                return Parser::make_COLON(loc);
+            case ';': // semicolon
+                step(next);
+                return Parser::make_SEMICOLON(loc);
+            case '=': // equal sign
+                step(next);
+                return Parser::make_ASSIGN(loc);
+            case ',': // comma
+                step(next);
+                return Parser::make_COMMA(loc);
+            case '@': // at sign
+                step(next);
+                return Parser::make_AT(loc);
+            default:
+                break;
+            }
+        }
+
+        /* yet unmatched characters */
+        step(text + 1);
+        if (reportErrors)
+            std::cerr << "unmatched character: " << c;
+        else
+            ++unreportedErrors;
+    }
+}
+
+void Scanner::step(const char * next) {
+    location.begin.line = location.end.line;
+    location.begin.column = location.end.column;
+    location.end.column += next - current;
+    current = next;
+}
+
+void Scanner::stepLines(const char * next) {
+    location.begin.line = location.end.line;
+    location.begin.column = location.end.column;
+    for (; current != next; ++current) {
+        if (*current == '\n') {
+            location.end.line++;
+            location.end.column = 0;
+        } else {
+            location.end.column++;
+        }
+    }
+}
+
+}
+}
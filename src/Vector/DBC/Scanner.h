@@ -2,26 +2,9 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <cstddef>
 #include <iostream>
-
-#if !defined(yyFlexLexerOnce)
-#include <FlexLexer.h>
-#endif
-
-#define YY_DECL Vector::DBC::Parser::symbol_type Vector::DBC::Scanner::yylex(const Vector::DBC::Parser::location_type & loc)
-
-#define YY_USER_ACTION \
-    location.begin.line = location.end.line; \
-    location.begin.column = location.end.column; \
-    for (int i = 0; yytext[i] != '\0'; i++) { \
-        if(yytext[i] == '\n') { \
-            location.end.line++; \
-            location.end.column = 0; \
-        } \
-        else { \
-            location.end.column++; \
-        } \
-    }
+#include <string>
 
 #include <Vector/DBC/Parser.hpp>
 
@@ -31,14 +14,27 @@ namespace DBC {
 /**
  * @brief Lex scanner class
  *
- * This contains the converter-specific Flex Lexer class.
+ * Hand-written scanner working on the complete input in one buffer.
+ * Keywords are recognized with a perfect hash over the identifier,
+ * tokens are taken as ranges of the buffer and only copied into the
+ * token value when the parser needs one.
  */
-class Scanner : public yyFlexLexer {
+class Scanner {
   public:
-    Scanner(std::istream & istream) :
-        yyFlexLexer(&istream),
-        location()
-    { }
+    /**
+     * @brief Constructor
+     * @param[in] istream Input stream, which is read completely
+     */
+    explicit Scanner(std::istream & istream);
+
+    /**
+     * @brief Constructor
+     * @param[in] data Input data, which must stay valid while scanning
+     * @param[in] size Size of input data
+     *
+     * The data is scanned in place, without copying it.
+     */
+    Scanner(const char * data, std::size_t size);
 
     /**
      * lexer function
@@ -48,8 +44,49 @@ class Scanner : public yyFlexLexer {
      */
     Parser::symbol_type yylex(const Parser::location_type & loc);
 
+    /**
+     * @brief Scan a fragment of the messages section
+     *
+     * The parser then only accepts message definitions (BO_, SG_).
+     */
+    void startMessagesFragment();
+
     /** location */
     Parser::location_type location;
+
+    /** report parse errors and unmatched characters on std::cerr */
+    bool reportErrors;
+
+    /** number of unmatched characters, which were not reported */
+    std::size_t unreportedErrors;
+
+  private:
+    /** input buffer (only for stream input) */
+    std::string buffer;
+
+    /** current position in buffer */
+    const char * current;
+
+    /** end of buffer */
+    const char * end;
+
+    /** within new symbols (NS_) section */
+    bool newSymbols;
+
+    /** next token starts a messages fragment */
+    bool messagesFragment;
+
+    /**
+     * @brief Advance over a token without line breaks
+     * @param[in] next Position after the token
+     */
+    void step(const char * next);
+
+    /**
+     * @brief Advance over a token that may contain line breaks
+     * @param[in] next Position after the token
+     */
+    void stepLines(const char * next);
 };
 
 }
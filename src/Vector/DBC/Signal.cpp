@@ -25,6 +25,8 @@
 
 #include <Vector/DBC/Signal.h>
 
+#include <Vector/DBC/CompiledSignal.h>
+
 namespace Vector {
 namespace DBC {
 
@@ -85,95 +87,110 @@ double Signal::maximumRawValue() const {
     return maximumRawValue;
 }
 
-uint64_t Signal::decode(std::vector<uint8_t> & data) const {
+uint64_t Signal::decode(const std::vector<uint8_t> & data) const {
+    return decode(data.data(), data.size());
+}
+
+uint64_t Signal::decode(const uint8_t * data, std::size_t size) const {
     /* safety check */
-    if (bitSize == 0)
+    if ((bitSize == 0) || (bitSize > 64))
         return 0;
 
+    /* first byte covered by the signal, this is the only bounds check */
+    const std::size_t firstByte = startBit / 8;
+    if (firstByte >= size)
+        return 0;
+
+    /* the signal covers at most 9 bytes, so load them directly or from a zero padded copy */
+    const uint8_t * bytes = data + firstByte;
+    uint8_t window[9] {};
+    if (size - firstByte < sizeof(window)) {
+        std::copy(bytes, data + size, window);
+        bytes = window;
+    }
+
     /* copy bits */
     uint64_t retVal = 0;
     if (byteOrder == ByteOrder::BigEndian) {
-        /* start with MSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = bitSize - 1;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (data[srcBit / 8] & (1 << (srcBit % 8)))
-                retVal |= (1ULL << dstBit);
-
-            /* calculate next position */
-            if ((srcBit % 8) == 0)
-                srcBit += 15;
-            else
-                --srcBit;
-            --dstBit;
-        }
+        /* position of LSB, counted from the MSB of the first byte */
+        const unsigned int lsbPosition = (7 - (startBit % 8)) + bitSize - 1;
+        const uint64_t word = CompiledSignal::loadBigEndian(bytes);
+        if (lsbPosition < 64)
+            retVal = word >> (63 - lsbPosition);
+        else
+            retVal = (word << (lsbPosition - 63)) | (bytes[8] >> (71 - lsbPosition));
     } else {
-        /* start with LSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = 0;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (data[srcBit / 8] & (1 << (srcBit % 8)))
-                retVal |= (1ULL << dstBit);
-
-            /* calculate next position */
-            ++srcBit;
-            ++dstBit;
-        }
+        /* position of LSB, counted from the LSB of the first byte */
+        const unsigned int lsbPosition = startBit % 8;
+        const uint64_t word = CompiledSignal::loadLittleEndian(bytes);
+        retVal = word >> lsbPosition;
+        if (lsbPosition + bitSize > 64)
+            retVal |= static_cast<uint64_t>(bytes[8]) << (64 - lsbPosition);
     }
 
-    /* if signed, then fill all bits above MSB with 1 */
-    if (valueType == ValueType::Signed) {
-        if (retVal & (1 << (bitSize - 1))) {
-            for (auto i = bitSize; i < 64; ++i)
-                retVal |= (1ULL << i);
-        }
-    }
+    /* move MSB to bit 63 and back, which clears or (if signed) fills all bits above MSB */
+    const unsigned int unusedBits = 64 - bitSize;
+    retVal <<= unusedBits;
+    if (valueType == ValueType::Signed)
+        retVal = static_cast<uint64_t>(static_cast<int64_t>(retVal) >> unusedBits);
+    else
+        retVal >>= unusedBits;
 
     return retVal;
 }
 
 void Signal::encode(std::vector<uint8_t> & data, uint64_t rawValue) const {
+    encode(data.data(), data.size(), rawValue);
+}
+
+void Signal::encode(uint8_t * data, std::size_t size, uint64_t rawValue) const {
     /* safety check */
-    if (bitSize == 0)
+    if ((bitSize == 0) || (bitSize > 64))
         return;
 
-    /* copy bits */
+    /* first byte covered by the signal, this is the only bounds check */
+    const std::size_t firstByte = startBit / 8;
+    if (firstByte >= size)
+        return;
+
+    /* the signal covers at most 9 bytes, so merge them directly or in a zero padded copy */
+    uint8_t * bytes = data + firstByte;
+    uint8_t window[9] {};
+    const std::size_t available = size - firstByte;
+    if (available < sizeof(window)) {
+        std::copy(bytes, data + size, window);
+        bytes = window;
+    }
+
+    /* merge bits */
+    const uint64_t mask = ~0ULL >> (64 - bitSize);
+    rawValue &= mask;
     if (byteOrder == ByteOrder::BigEndian) {
-        /* start with MSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = bitSize - 1;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (rawValue & (1ULL << dstBit))
-                data[srcBit / 8] |= (1 << (srcBit % 8));
-            else
-                data[srcBit / 8] &= ~(1 << (srcBit % 8));
-
-            /* calculate next position */
-            if ((srcBit % 8) == 0)
-                srcBit += 15;
-            else
-                --srcBit;
-            --dstBit;
+        /* position of LSB, counted from the MSB of the first byte */
+        const unsigned int lsbPosition = (7 - (startBit % 8)) + bitSize - 1;
+        uint64_t word = CompiledSignal::loadBigEndian(bytes);
+        if (lsbPosition < 64) {
+            const unsigned int shift = 63 - lsbPosition;
+            word = (word & ~(mask << shift)) | (rawValue << shift);
+        } else {
+            const unsigned int shift = lsbPosition - 63;
+            word = (word & ~(mask >> shift)) | (rawValue >> shift);
+            bytes[8] = static_cast<uint8_t>((bytes[8] & ~(mask << (71 - lsbPosition))) | (rawValue << (71 - lsbPosition)));
         }
+        CompiledSignal::storeBigEndian(bytes, word);
     } else {
-        /* start with LSB */
-        unsigned int srcBit = startBit;
-        unsigned int dstBit = 0;
-        for (uint32_t i = 0; i < bitSize; ++i) {
-            /* copy bit */
-            if (rawValue & (1ULL << dstBit))
-                data[srcBit / 8] |= (1 << (srcBit % 8));
-            else
-                data[srcBit / 8] &= ~(1 << (srcBit % 8));
-
-            /* calculate next position */
-            ++srcBit;
-            ++dstBit;
-        }
+        /* position of LSB, counted from the LSB of the first byte */
+        const unsigned int lsbPosition = startBit % 8;
+        uint64_t word = CompiledSignal::loadLittleEndian(bytes);
+        word = (word & ~(mask << lsbPosition)) | (rawValue << lsbPosition);
+        if (lsbPosition + bitSize > 64)
+            bytes[8] = static_cast<uint8_t>((bytes[8] & ~(mask >> (64 - lsbPosition))) | (rawValue >> (64 - lsbPosition)));
+        CompiledSignal::storeLittleEndian(bytes, word);
     }
+
+    /* write back the copy */
+    if (bytes == window)
+        std::copy(window, window + available, data + firstByte);
 }
 
 std::ostream & operator<<(std::ostream & os, const Signal & signal) {
@@ -23,6 +23,8 @@
 
 #include <Vector/DBC/platform.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <ostream>
@@ -30,9 +32,12 @@
 #include <string>
 #include <vector>
 
+#include <Vector/DBC/Arena.h>
 #include <Vector/DBC/Attribute.h>
 #include <Vector/DBC/ByteOrder.h>
 #include <Vector/DBC/ExtendedMultiplexor.h>
+#include <Vector/DBC/Span.h>
+#include <Vector/DBC/Symbol.h>
 #include <Vector/DBC/ValueDescriptions.h>
 #include <Vector/DBC/ValueType.h>
 
@@ -43,6 +48,8 @@ namespace DBC {
 
 /**
  * Signal (SG)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT Signal {
     /** Name */
@@ -94,7 +101,7 @@ struct VECTOR_DBC_EXPORT Signal {
     std::string unit {};
 
     /** Receivers */
-    std::set<std::string> receivers {};
+    ArenaSet<Symbol> receivers {};
 
     /** Signal Extended Value Type (SIG_VALTYPE, obsolete) */
     enum class ExtendedValueType : char {
@@ -124,10 +131,10 @@ struct VECTOR_DBC_EXPORT Signal {
     std::string comment {};
 
     /** Attribute Values (BA) */
-    std::map<std::string, Attribute> attributeValues {};
+    ArenaMap<Symbol, Attribute> attributeValues {};
 
     /** Extended Multiplexors (SG_MUL_VAL) */
-    std::map<std::string, ExtendedMultiplexor> extendedMultiplexors {};
+    ArenaMap<std::string, ExtendedMultiplexor> extendedMultiplexors {};
 
     /**
      * @brief Convert from Raw to Physical Value
@@ -169,10 +176,50 @@ struct VECTOR_DBC_EXPORT Signal {
      * @return Raw signal value
      *
      * Decodes/Extracts a signal from the message data.
+     * Bytes beyond the end of data are read as zero.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    uint64_t decode(const std::vector<uint8_t> & data) const;
+
+    /**
+     * @brief Decodes/Extracts a signal from the message data
+     * @param[in] data Data
+     * @return Raw signal value
+     *
+     * Decodes/Extracts a signal in place, e.g. from a ring buffer or a
+     * memory mapped log. Bytes beyond the end of data are read as zero.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    uint64_t decode(Span<const uint8_t> data) const {
+        return decode(data.data(), data.size());
+    }
+
+    /**
+     * @brief Decodes/Extracts a signal from a fixed size frame
+     * @param[in] data Data (e.g. 8 bytes for CAN, 64 bytes for CAN FD)
+     * @return Raw signal value
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    template<std::size_t N>
+    uint64_t decode(const std::array<uint8_t, N> & data) const {
+        return decode(data.data(), N);
+    }
+
+    /**
+     * @brief Decodes/Extracts a signal from the message data
+     * @param[in] data Data
+     * @param[in] size Data Size (e.g. up to 64 bytes for CAN FD)
+     * @return Raw signal value
+     *
+     * Decodes/Extracts a signal from the message data.
+     * Bounds are checked once. Bytes beyond size are read as zero.
      *
      * @note Multiplexors are not taken into account.
      */
-    uint64_t decode(std::vector<uint8_t> & data) const;
+    uint64_t decode(const uint8_t * data, std::size_t size) const;
 
     /**
      * @brief Encodes a signal into the message data
@@ -180,10 +227,49 @@ struct VECTOR_DBC_EXPORT Signal {
      * @param[in] rawValue Raw signal value
      *
      * Encode a signal into the message data.
+     * Bits beyond the end of data are not written.
      *
      * @note Multiplexors are not taken into account.
      */
     void encode(std::vector<uint8_t> & data, uint64_t rawValue) const;
+
+    /**
+     * @brief Encodes a signal into the message data
+     * @param[inout] data Data
+     * @param[in] rawValue Raw signal value
+     *
+     * Encode a signal in place. Bits beyond the end of data are not written.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    void encode(Span<uint8_t> data, uint64_t rawValue) const {
+        encode(data.data(), data.size(), rawValue);
+    }
+
+    /**
+     * @brief Encodes a signal into a fixed size frame
+     * @param[inout] data Data (e.g. 8 bytes for CAN, 64 bytes for CAN FD)
+     * @param[in] rawValue Raw signal value
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    template<std::size_t N>
+    void encode(std::array<uint8_t, N> & data, uint64_t rawValue) const {
+        encode(data.data(), N, rawValue);
+    }
+
+    /**
+     * @brief Encodes a signal into the message data
+     * @param[inout] data Data
+     * @param[in] size Data Size (e.g. up to 64 bytes for CAN FD)
+     * @param[in] rawValue Raw signal value
+     *
+     * Encode a signal into the message data.
+     * Bounds are checked once. Bits beyond size are not written.
+     *
+     * @note Multiplexors are not taken into account.
+     */
+    void encode(uint8_t * data, std::size_t size, uint64_t rawValue) const;
 };
 
 std::ostream & operator<<(std::ostream & os, const Signal & signal);
@@ -28,6 +28,8 @@
 #include <set>
 #include <string>
 
+#include <Vector/DBC/Arena.h>
+
 #include <Vector/DBC/vector_dbc_export.h>
 
 namespace Vector {
@@ -35,6 +37,8 @@ namespace DBC {
 
 /**
  * Signal Group (SIG_GROUP)
+ *
+ * Containers bind to an arena like those of Network.
  */
 struct VECTOR_DBC_EXPORT SignalGroup {
     /** Message Identifier */
@@ -53,7 +57,7 @@ struct VECTOR_DBC_EXPORT SignalGroup {
     uint32_t repetitions { 1 };
 
     /** Signals */
-    std::set<std::string> signals {};
+    ArenaSet<std::string> signals {};
 };
 
 std::ostream & operator<<(std::ostream & os, const SignalGroup & signalGroup);
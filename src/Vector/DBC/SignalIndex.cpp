@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <algorithm>
+
+#include <Vector/DBC/SignalIndex.h>
+
+namespace Vector {
+namespace DBC {
+
+SignalIndex::SignalIndex(const Network & network) :
+    network(network) {
+}
+
+const SignalReference * SignalIndex::find(const std::string & name) const {
+    std::call_once(built, &SignalIndex::build, this);
+
+    /* qualified name */
+    if (name.find('.') != std::string::npos) {
+        auto it = qualifiedNames.find(name);
+        if (it == qualifiedNames.end())
+            return nullptr;
+        return &signalReferences[it->second];
+    }
+
+    /* signal name */
+    auto it = names.find(name);
+    if (it == names.end())
+        return nullptr;
+    return &signalReferences[it->second.first];
+}
+
+std::pair<const SignalReference *, const SignalReference *> SignalIndex::findAll(const std::string & name) const {
+    std::call_once(built, &SignalIndex::build, this);
+
+    auto it = names.find(name);
+    if (it == names.end())
+        return std::make_pair(nullptr, nullptr);
+    return std::make_pair(signalReferences.data() + it->second.first, signalReferences.data() + it->second.second);
+}
+
+void SignalIndex::build() const {
+    /* collect all signals, messages are sorted by identifier */
+    std::vector<std::pair<const std::string *, SignalReference>> entries;
+    for (const auto & message : network.messages) {
+        for (const auto & signal : message.second.signals) {
+            SignalReference signalReference;
+            signalReference.messageId = message.first;
+            signalReference.message = &message.second;
+            signalReference.signal = &signal.second;
+            entries.emplace_back(&signal.first, signalReference);
+        }
+    }
+
+    /* group by name, keeping the message order */
+    std::stable_sort(entries.begin(), entries.end(), [](const std::pair<const std::string *, SignalReference> & lhs, const std::pair<const std::string *, SignalReference> & rhs) {
+        return *lhs.first < *rhs.first;
+    });
+
+    /* fill hash tables */
+    signalReferences.reserve(entries.size());
+    names.reserve(entries.size());
+    qualifiedNames.reserve(entries.size());
+    for (const auto & entry : entries) {
+        const std::size_t index = signalReferences.size();
+        signalReferences.push_back(entry.second);
+        auto it = names.emplace(*entry.first, std::make_pair(index, index)).first;
+        it->second.second = index + 1;
+        qualifiedNames.emplace(entry.second.message->name + '.' + *entry.first, index);
+    }
+}
+
+}
+}
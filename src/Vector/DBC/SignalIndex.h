@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Vector/DBC/Message.h>
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/Signal.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Signal Reference
+ */
+struct VECTOR_DBC_EXPORT SignalReference {
+    /** Message Identifier */
+    uint32_t messageId {};
+
+    /** Message */
+    const Message * message {};
+
+    /** Signal */
+    const Signal * signal {};
+};
+
+/**
+ * Signal Index
+ *
+ * Hash index from signal name to message and signal over the whole
+ * network. Signals can be found by their name or by the qualified name
+ * "Message.Signal".
+ *
+ * The index is built on the first query. Queries are thread-safe.
+ *
+ * The index refers to the messages and signals of the network, so the
+ * network must not be changed or destroyed while the index is used.
+ */
+class VECTOR_DBC_EXPORT SignalIndex {
+  public:
+    /**
+     * @brief Create index for network
+     * @param[in] network Network
+     */
+    explicit SignalIndex(const Network & network);
+
+    SignalIndex(const SignalIndex &) = delete;
+    SignalIndex & operator=(const SignalIndex &) = delete;
+
+    /**
+     * @brief Find signal
+     * @param[in] name Signal Name or qualified name "Message.Signal"
+     * @return Signal Reference (nullptr if signal is unknown)
+     *
+     * If signals with the same name exist in several messages, the one
+     * in the message with the lowest identifier is returned.
+     */
+    const SignalReference * find(const std::string & name) const;
+
+    /**
+     * @brief Find all signals with a name
+     * @param[in] name Signal Name
+     * @return Signal References (sorted by message identifier)
+     */
+    std::pair<const SignalReference *, const SignalReference *> findAll(const std::string & name) const;
+
+  private:
+    /** Network */
+    const Network & network;
+
+    /** Build flag */
+    mutable std::once_flag built {};
+
+    /** Signal References (grouped by name, sorted by message identifier) */
+    mutable std::vector<SignalReference> signalReferences {};
+
+    /** Signal Name to first and last index in signalReferences */
+    mutable std::unordered_map<std::string, std::pair<std::size_t, std::size_t>> names {};
+
+    /** Qualified Name to index in signalReferences */
+    mutable std::unordered_map<std::string, std::size_t> qualifiedNames {};
+
+    /** Build index */
+    void build() const;
+};
+
+}
+}
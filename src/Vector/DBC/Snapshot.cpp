@@ -0,0 +1,1018 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/Snapshot.h>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Vector/DBC/MappedFile.h>
+
+namespace Vector {
+namespace DBC {
+
+using namespace SnapshotFormat;
+
+/** alignment of sections */
+static const std::size_t sectionAlignment = 8;
+
+/**
+ * @brief Get record size of a section
+ * @param[in] type Section type
+ * @return Record size (0 for unknown section types)
+ */
+static std::size_t recordSize(SectionType type) {
+    switch (type) {
+    case SectionType::Strings:
+        return sizeof(char);
+    case SectionType::StringLists:
+        return sizeof(String);
+    case SectionType::Network:
+        return sizeof(NetworkRecord);
+    case SectionType::Nodes:
+        return sizeof(NodeRecord);
+    case SectionType::ValueTables:
+        return sizeof(ValueTableRecord);
+    case SectionType::ValueDescriptions:
+        return sizeof(ValueDescriptionRecord);
+    case SectionType::Messages:
+        return sizeof(MessageRecord);
+    case SectionType::Signals:
+        return sizeof(SignalRecord);
+    case SectionType::SignalGroups:
+        return sizeof(SignalGroupRecord);
+    case SectionType::EnvironmentVariables:
+        return sizeof(EnvironmentVariableRecord);
+    case SectionType::SignalTypes:
+        return sizeof(SignalTypeRecord);
+    case SectionType::AttributeDefinitions:
+        return sizeof(AttributeDefinitionRecord);
+    case SectionType::Attributes:
+        return sizeof(AttributeRecord);
+    case SectionType::AttributeRelations:
+        return sizeof(AttributeRelationRecord);
+    case SectionType::ExtendedMultiplexors:
+        return sizeof(ExtendedMultiplexorRecord);
+    case SectionType::ValueRanges:
+        return sizeof(ValueRangeRecord);
+    case SectionType::MessageIds:
+        return sizeof(MessageIdSlot);
+    case SectionType::MessageNames:
+        return sizeof(MessageNameSlot);
+    }
+    return 0;
+}
+
+/* validation */
+
+static bool validString(const Snapshot & snapshot, String string) {
+    return uint64_t(string.offset) + string.length <= snapshot.strings().size();
+}
+
+template<typename Record>
+static bool validRange(const Snapshot & snapshot, Range range) {
+    return uint64_t(range.first) + range.count <= snapshot.records<Record>().size();
+}
+
+static bool validObjectType(uint32_t objectType) {
+    return objectType <= static_cast<uint32_t>(AttributeObjectType::NodeMappedRxSignal);
+}
+
+static bool validRecord(const Snapshot & snapshot, const String & record) {
+    return validString(snapshot, record);
+}
+
+static bool validRecord(const Snapshot & snapshot, const NetworkRecord & record) {
+    return
+        validString(snapshot, record.version) &&
+        validString(snapshot, record.comment) &&
+        validRange<String>(snapshot, record.newSymbols) &&
+        validRange<NodeRecord>(snapshot, record.nodes) &&
+        validRange<ValueTableRecord>(snapshot, record.valueTables) &&
+        validRange<MessageRecord>(snapshot, record.messages) &&
+        validRange<EnvironmentVariableRecord>(snapshot, record.environmentVariables) &&
+        validRange<SignalTypeRecord>(snapshot, record.signalTypes) &&
+        validRange<AttributeDefinitionRecord>(snapshot, record.attributeDefinitions) &&
+        validRange<AttributeRecord>(snapshot, record.attributeDefaults) &&
+        validRange<AttributeRecord>(snapshot, record.attributeValues) &&
+        validRange<AttributeRelationRecord>(snapshot, record.attributeRelationValues);
+}
+
+static bool validRecord(const Snapshot & snapshot, const NodeRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validString(snapshot, record.comment) &&
+        validRange<AttributeRecord>(snapshot, record.attributeValues);
+}
+
+static bool validRecord(const Snapshot & snapshot, const ValueTableRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validRange<ValueDescriptionRecord>(snapshot, record.valueDescriptions);
+}
+
+static bool validRecord(const Snapshot & snapshot, const ValueDescriptionRecord & record) {
+    return validString(snapshot, record.description);
+}
+
+static bool validRecord(const Snapshot & snapshot, const MessageRecord & record) {
+    return
+        validString(snapshot, record.name) &&
+        validString(snapshot, record.transmitter) &&
+        validString(snapshot, record.comment) &&
+        validRange<SignalRecord>(snapshot, record.signals) &&
+        validRange<String>(snapshot, record.transmitters) &&
+        validRange<SignalGroupRecord>(snapshot, record.signalGroups) &&
+        validRange<AttributeRecord>(snapshot, record.attributeValues);
+}
+
+static bool validRecord(const Snapshot & snapshot, const SignalRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validString(snapshot, record.unit) &&
+        validString(snapshot, record.type) &&
+        validString(snapshot, record.comment) &&
+        validRange<String>(snapshot, record.receivers) &&
+        validRange<ValueDescriptionRecord>(snapshot, record.valueDescriptions) &&
+        validRange<AttributeRecord>(snapshot, record.attributeValues) &&
+        validRange<ExtendedMultiplexorRecord>(snapshot, record.extendedMultiplexors);
+}
+
+static bool validRecord(const Snapshot & snapshot, const SignalGroupRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validRange<String>(snapshot, record.signals);
+}
+
+static bool validRecord(const Snapshot & snapshot, const EnvironmentVariableRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validString(snapshot, record.unit) &&
+        validString(snapshot, record.comment) &&
+        validRange<String>(snapshot, record.accessNodes) &&
+        validRange<ValueDescriptionRecord>(snapshot, record.valueDescriptions) &&
+        validRange<AttributeRecord>(snapshot, record.attributeValues);
+}
+
+static bool validRecord(const Snapshot & snapshot, const SignalTypeRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validString(snapshot, record.unit) &&
+        validString(snapshot, record.valueTable);
+}
+
+static bool validRecord(const Snapshot & snapshot, const AttributeDefinitionRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validObjectType(record.objectType) &&
+        (record.valueType <= static_cast<uint32_t>(AttributeValueType::Type::Enum)) &&
+        validRange<String>(snapshot, record.enumValues);
+}
+
+static bool validRecord(const Snapshot & snapshot, const AttributeRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.name) &&
+        validObjectType(record.objectType) &&
+        validString(snapshot, record.stringValue);
+}
+
+static bool validRecord(const Snapshot & snapshot, const AttributeRelationRecord & record) {
+    return
+        validRecord(snapshot, record.attribute) &&
+        validString(snapshot, record.nodeName) &&
+        validString(snapshot, record.environmentVariableName) &&
+        validString(snapshot, record.signalName);
+}
+
+static bool validRecord(const Snapshot & snapshot, const ExtendedMultiplexorRecord & record) {
+    return
+        validString(snapshot, record.key) &&
+        validString(snapshot, record.switchName) &&
+        validRange<ValueRangeRecord>(snapshot, record.valueRanges);
+}
+
+static bool validRecord(const Snapshot & /*snapshot*/, const ValueRangeRecord & /*record*/) {
+    return true;
+}
+
+/**
+ * @brief Check lookup table
+ * @param[in] snapshot Snapshot
+ * @return true if the slots refer to messages and probing terminates
+ */
+template<typename Slot>
+static bool validSlots(const Snapshot & snapshot) {
+    const Span<const Slot> slots = snapshot.records<Slot>();
+    if ((slots.size() & (slots.size() - 1)) != 0)
+        return false;
+    bool emptySlotFound = slots.empty();
+    for (const Slot & slot : slots) {
+        if (slot.message == emptySlot)
+            emptySlotFound = true;
+        else if (slot.message >= snapshot.records<MessageRecord>().size())
+            return false;
+    }
+    return emptySlotFound;
+}
+
+/**
+ * @brief Check all records of a section
+ * @param[in] snapshot Snapshot
+ * @return true if all strings and ranges are within their sections
+ */
+template<typename Record>
+static bool validRecords(const Snapshot & snapshot) {
+    for (const Record & record : snapshot.records<Record>()) {
+        if (!validRecord(snapshot, record))
+            return false;
+    }
+    return true;
+}
+
+bool Snapshot::open(const char * data, std::size_t size) {
+    sectionData.fill(nullptr);
+    sectionCount.fill(0);
+    opened = validate(data, size);
+
+    /* sections of an invalid snapshot must not be used */
+    if (!opened) {
+        sectionData.fill(nullptr);
+        sectionCount.fill(0);
+    }
+    return opened;
+}
+
+bool Snapshot::validate(const char * data, std::size_t size) {
+    /* header */
+    if ((data == nullptr) || (reinterpret_cast<std::uintptr_t>(data) % sectionAlignment != 0) || (size < sizeof(Header)))
+        return false;
+    const Header * header = reinterpret_cast<const Header *>(data);
+    if ((std::memcmp(header->magic, magic, sizeof(magic)) != 0) ||
+            (header->byteOrderMark != byteOrderMark) ||
+            (header->version != version) ||
+            (header->size != size))
+        return false;
+
+    /* section table */
+    if (header->sectionCount > (size - sizeof(Header)) / sizeof(Section))
+        return false;
+    const Section * sections = reinterpret_cast<const Section *>(data + sizeof(Header));
+    for (uint32_t i = 0; i < header->sectionCount; ++i) {
+        const Section & section = sections[i];
+        const std::size_t type = static_cast<std::size_t>(section.type);
+        if ((type == 0) || (type >= sectionTypeCount) || (sectionData[type] != nullptr))
+            return false;
+        if ((section.offset % sectionAlignment != 0) || (section.offset > size))
+            return false;
+        if (section.count > (size - section.offset) / recordSize(section.type))
+            return false;
+        sectionData[type] = data + section.offset;
+        sectionCount[type] = section.count;
+    }
+    if (records<NetworkRecord>().size() != 1)
+        return false;
+
+    /* strings and ranges */
+    if (!validRecords<String>(*this) ||
+            !validRecords<NetworkRecord>(*this) ||
+            !validRecords<NodeRecord>(*this) ||
+            !validRecords<ValueTableRecord>(*this) ||
+            !validRecords<ValueDescriptionRecord>(*this) ||
+            !validRecords<MessageRecord>(*this) ||
+            !validRecords<SignalRecord>(*this) ||
+            !validRecords<SignalGroupRecord>(*this) ||
+            !validRecords<EnvironmentVariableRecord>(*this) ||
+            !validRecords<SignalTypeRecord>(*this) ||
+            !validRecords<AttributeDefinitionRecord>(*this) ||
+            !validRecords<AttributeRecord>(*this) ||
+            !validRecords<AttributeRelationRecord>(*this) ||
+            !validRecords<ExtendedMultiplexorRecord>(*this) ||
+            !validRecords<ValueRangeRecord>(*this) ||
+            !validSlots<MessageIdSlot>(*this) ||
+            !validSlots<MessageNameSlot>(*this))
+        return false;
+
+    return true;
+}
+
+/* writer */
+
+/**
+ * Snapshot Writer
+ *
+ * Collects the records of all sections, so that the records of one
+ * range are consecutive, and deduplicates strings.
+ */
+struct SnapshotWriter {
+    /** network */
+    const Network & network;
+
+    /** character data of all strings */
+    std::string strings {};
+
+    /** offsets of strings in character data */
+    std::unordered_map<std::string, uint32_t> stringOffsets {};
+
+    /** a string or range doesn't fit in 32 bits */
+    bool overflow {};
+
+    /** records */
+    std::vector<String> stringLists {};
+    std::vector<NetworkRecord> networks {};
+    std::vector<NodeRecord> nodes {};
+    std::vector<ValueTableRecord> valueTables {};
+    std::vector<ValueDescriptionRecord> valueDescriptions {};
+    std::vector<MessageRecord> messages {};
+    std::vector<SignalRecord> signals {};
+    std::vector<SignalGroupRecord> signalGroups {};
+    std::vector<EnvironmentVariableRecord> environmentVariables {};
+    std::vector<SignalTypeRecord> signalTypes {};
+    std::vector<AttributeDefinitionRecord> attributeDefinitions {};
+    std::vector<AttributeRecord> attributes {};
+    std::vector<AttributeRelationRecord> attributeRelations {};
+    std::vector<ExtendedMultiplexorRecord> extendedMultiplexors {};
+    std::vector<ValueRangeRecord> valueRanges {};
+    std::vector<MessageIdSlot> messageIds {};
+    std::vector<MessageNameSlot> messageNames {};
+
+    explicit SnapshotWriter(const Network & network) :
+        network(network) {
+    }
+
+    /** add string, equal strings are stored once */
+    String addString(const std::string & value) {
+        String string {};
+        string.length = static_cast<uint32_t>(value.size());
+        auto result = stringOffsets.emplace(value, static_cast<uint32_t>(strings.size()));
+        if (result.second) {
+            if (strings.size() + value.size() > std::numeric_limits<uint32_t>::max())
+                overflow = true;
+            strings.append(value);
+        }
+        string.offset = result.first->second;
+        return string;
+    }
+
+    /** get range from first record to end of records */
+    template<typename Record>
+    Range rangeFrom(const std::vector<Record> & records, std::size_t first) {
+        if (records.size() > std::numeric_limits<uint32_t>::max())
+            overflow = true;
+        Range range {};
+        range.first = static_cast<uint32_t>(first);
+        range.count = static_cast<uint32_t>(records.size() - first);
+        return range;
+    }
+
+    template<typename Container>
+    Range addStringList(const Container & container) {
+        const std::size_t first = stringLists.size();
+        for (const std::string & value : container)
+            stringLists.push_back(addString(value));
+        return rangeFrom(stringLists, first);
+    }
+
+    Range addValueDescriptions(const ValueDescriptions & container) {
+        const std::size_t first = valueDescriptions.size();
+        for (const auto & valueDescription : container) {
+            ValueDescriptionRecord record {};
+            record.value = valueDescription.first;
+            record.description = addString(valueDescription.second);
+            valueDescriptions.push_back(record);
+        }
+        return rangeFrom(valueDescriptions, first);
+    }
+
+    /** get value union of attribute, based on the value type of its definition */
+    uint64_t attributeValue(const Attribute & attribute) const {
+        uint64_t value = 0;
+        auto attributeDefinition = network.attributeDefinitions.find(attribute.name);
+        if (attributeDefinition == network.attributeDefinitions.end()) {
+            std::memcpy(&value, &attribute.floatValue, sizeof(value));
+            return value;
+        }
+        switch (attributeDefinition->second.valueType.type) {
+        case AttributeValueType::Type::Float:
+            std::memcpy(&value, &attribute.floatValue, sizeof(value));
+            break;
+        case AttributeValueType::Type::String:
+            break;
+        default:
+            value = static_cast<uint32_t>(attribute.integerValue);
+            break;
+        }
+        return value;
+    }
+
+    AttributeRecord attributeRecord(const std::string & key, const Attribute & attribute) {
+        AttributeRecord record {};
+        record.key = addString(key);
+        record.name = addString(attribute.name);
+        record.objectType = static_cast<uint32_t>(attribute.objectType);
+        record.value = attributeValue(attribute);
+        record.stringValue = addString(attribute.stringValue);
+        return record;
+    }
+
+    Range addAttributes(const ArenaMap<Symbol, Attribute> & container) {
+        const std::size_t first = attributes.size();
+        for (const auto & attribute : container)
+            attributes.push_back(attributeRecord(attribute.first, attribute.second));
+        return rangeFrom(attributes, first);
+    }
+
+    Range addExtendedMultiplexors(const ArenaMap<std::string, ExtendedMultiplexor> & container) {
+        const std::size_t first = extendedMultiplexors.size();
+        for (const auto & extendedMultiplexor : container) {
+            ExtendedMultiplexorRecord record {};
+            record.key = addString(extendedMultiplexor.first);
+            record.switchName = addString(extendedMultiplexor.second.switchName);
+            const std::size_t firstValueRange = valueRanges.size();
+            for (const ExtendedMultiplexor::ValueRange & valueRange : extendedMultiplexor.second.valueRanges) {
+                ValueRangeRecord valueRangeRecord {};
+                valueRangeRecord.minimum = valueRange.first;
+                valueRangeRecord.maximum = valueRange.second;
+                valueRanges.push_back(valueRangeRecord);
+            }
+            record.valueRanges = rangeFrom(valueRanges, firstValueRange);
+            extendedMultiplexors.push_back(record);
+        }
+        return rangeFrom(extendedMultiplexors, first);
+    }
+
+    SignalRecord signalRecord(const std::string & key, const Signal & signal) {
+        SignalRecord record {};
+        record.key = addString(key);
+        record.name = addString(signal.name);
+        record.startBit = signal.startBit;
+        record.bitSize = signal.bitSize;
+        record.multiplexerSwitchValue = signal.multiplexerSwitchValue;
+        record.multiplexor = static_cast<uint8_t>(signal.multiplexor);
+        record.byteOrder = static_cast<uint8_t>(signal.byteOrder);
+        record.valueType = static_cast<uint8_t>(signal.valueType);
+        record.extendedValueType = static_cast<uint8_t>(signal.extendedValueType);
+        record.factor = signal.factor;
+        record.offset = signal.offset;
+        record.minimum = signal.minimum;
+        record.maximum = signal.maximum;
+        record.unit = addString(signal.unit);
+        record.type = addString(signal.type);
+        record.comment = addString(signal.comment);
+        record.receivers = addStringList(signal.receivers);
+        record.valueDescriptions = addValueDescriptions(signal.valueDescriptions);
+        record.attributeValues = addAttributes(signal.attributeValues);
+        record.extendedMultiplexors = addExtendedMultiplexors(signal.extendedMultiplexors);
+        return record;
+    }
+
+    MessageRecord messageRecord(uint32_t key, const Message & message) {
+        MessageRecord record {};
+        record.key = key;
+        record.id = message.id;
+        record.name = addString(message.name);
+        record.size = message.size;
+        record.transmitter = addString(message.transmitter);
+        record.comment = addString(message.comment);
+        const std::size_t firstSignal = signals.size();
+        for (const auto & signal : message.signals)
+            signals.push_back(signalRecord(signal.first, signal.second));
+        record.signals = rangeFrom(signals, firstSignal);
+        record.transmitters = addStringList(message.transmitters);
+        const std::size_t firstSignalGroup = signalGroups.size();
+        for (const auto & signalGroup : message.signalGroups) {
+            SignalGroupRecord signalGroupRecord {};
+            signalGroupRecord.key = addString(signalGroup.first);
+            signalGroupRecord.name = addString(signalGroup.second.name);
+            signalGroupRecord.messageId = signalGroup.second.messageId;
+            signalGroupRecord.repetitions = signalGroup.second.repetitions;
+            signalGroupRecord.signals = addStringList(signalGroup.second.signals);
+            signalGroups.push_back(signalGroupRecord);
+        }
+        record.signalGroups = rangeFrom(signalGroups, firstSignalGroup);
+        record.attributeValues = addAttributes(message.attributeValues);
+        return record;
+    }
+
+    EnvironmentVariableRecord environmentVariableRecord(const std::string & key, const EnvironmentVariable & environmentVariable) {
+        EnvironmentVariableRecord record {};
+        record.key = addString(key);
+        record.name = addString(environmentVariable.name);
+        record.type = static_cast<uint8_t>(environmentVariable.type);
+        record.accessType = static_cast<uint16_t>(environmentVariable.accessType);
+        record.id = environmentVariable.id;
+        record.minimum = environmentVariable.minimum;
+        record.maximum = environmentVariable.maximum;
+        record.initialValue = environmentVariable.initialValue;
+        record.unit = addString(environmentVariable.unit);
+        record.comment = addString(environmentVariable.comment);
+        record.dataSize = environmentVariable.dataSize;
+        record.accessNodes = addStringList(environmentVariable.accessNodes);
+        record.valueDescriptions = addValueDescriptions(environmentVariable.valueDescriptions);
+        record.attributeValues = addAttributes(environmentVariable.attributeValues);
+        return record;
+    }
+
+    SignalTypeRecord signalTypeRecord(const std::string & key, const SignalType & signalType) {
+        SignalTypeRecord record {};
+        record.key = addString(key);
+        record.name = addString(signalType.name);
+        record.size = signalType.size;
+        record.byteOrder = static_cast<uint8_t>(signalType.byteOrder);
+        record.valueType = static_cast<uint8_t>(signalType.valueType);
+        record.factor = signalType.factor;
+        record.offset = signalType.offset;
+        record.minimum = signalType.minimum;
+        record.maximum = signalType.maximum;
+        record.defaultValue = signalType.defaultValue;
+        record.unit = addString(signalType.unit);
+        record.valueTable = addString(signalType.valueTable);
+        return record;
+    }
+
+    AttributeDefinitionRecord attributeDefinitionRecord(const std::string & key, const AttributeDefinition & attributeDefinition) {
+        AttributeDefinitionRecord record {};
+        record.key = addString(key);
+        record.name = addString(attributeDefinition.name);
+        record.objectType = static_cast<uint32_t>(attributeDefinition.objectType);
+        const AttributeValueType & valueType = attributeDefinition.valueType;
+        record.valueType = static_cast<uint32_t>(valueType.type);
+        switch (valueType.type) {
+        case AttributeValueType::Type::Int:
+            record.minimumMaximum[0] = static_cast<uint32_t>(valueType.integerValue.minimum);
+            record.minimumMaximum[1] = static_cast<uint32_t>(valueType.integerValue.maximum);
+            break;
+        case AttributeValueType::Type::Hex:
+            record.minimumMaximum[0] = static_cast<uint32_t>(valueType.hexValue.minimum);
+            record.minimumMaximum[1] = static_cast<uint32_t>(valueType.hexValue.maximum);
+            break;
+        case AttributeValueType::Type::Float:
+            std::memcpy(&record.minimumMaximum[0], &valueType.floatValue.minimum, sizeof(uint64_t));
+            std::memcpy(&record.minimumMaximum[1], &valueType.floatValue.maximum, sizeof(uint64_t));
+            break;
+        case AttributeValueType::Type::String:
+        case AttributeValueType::Type::Enum:
+            break;
+        }
+        record.enumValues = addStringList(valueType.enumValues);
+        return record;
+    }
+
+    void addNetwork() {
+        NetworkRecord record {};
+        record.version = addString(network.version);
+        record.comment = addString(network.comment);
+        record.baudrate = network.bitTiming.baudrate;
+        record.btr1 = network.bitTiming.btr1;
+        record.btr2 = network.bitTiming.btr2;
+        record.newSymbols = addStringList(network.newSymbols);
+
+        /* nodes */
+        for (const auto & node : network.nodes) {
+            NodeRecord nodeRecord {};
+            nodeRecord.key = addString(node.first);
+            nodeRecord.name = addString(node.second.name);
+            nodeRecord.comment = addString(node.second.comment);
+            nodeRecord.attributeValues = addAttributes(node.second.attributeValues);
+            nodes.push_back(nodeRecord);
+        }
+        record.nodes = rangeFrom(nodes, 0);
+
+        /* value tables */
+        for (const auto & valueTable : network.valueTables) {
+            ValueTableRecord valueTableRecord {};
+            valueTableRecord.key = addString(valueTable.first);
+            valueTableRecord.name = addString(valueTable.second.name);
+            valueTableRecord.valueDescriptions = addValueDescriptions(valueTable.second.valueDescriptions);
+            valueTables.push_back(valueTableRecord);
+        }
+        record.valueTables = rangeFrom(valueTables, 0);
+
+        /* messages */
+        for (const auto & message : network.messages)
+            messages.push_back(messageRecord(message.first, message.second));
+        record.messages = rangeFrom(messages, 0);
+
+        /* environment variables */
+        for (const auto & environmentVariable : network.environmentVariables)
+            environmentVariables.push_back(environmentVariableRecord(environmentVariable.first, environmentVariable.second));
+        record.environmentVariables = rangeFrom(environmentVariables, 0);
+
+        /* signal types */
+        for (const auto & signalType : network.signalTypes)
+            signalTypes.push_back(signalTypeRecord(signalType.first, signalType.second));
+        record.signalTypes = rangeFrom(signalTypes, 0);
+
+        /* attribute definitions */
+        for (const auto & attributeDefinition : network.attributeDefinitions)
+            attributeDefinitions.push_back(attributeDefinitionRecord(attributeDefinition.first, attributeDefinition.second));
+        record.attributeDefinitions = rangeFrom(attributeDefinitions, 0);
+
+        /* attributes */
+        record.attributeDefaults = addAttributes(network.attributeDefaults);
+        record.attributeValues = addAttributes(network.attributeValues);
+
+        /* attribute relations */
+        for (const auto & attributeRelation : network.attributeRelationValues) {
+            AttributeRelationRecord attributeRelationRecord {};
+            attributeRelationRecord.attribute = attributeRecord(attributeRelation.first, attributeRelation.second);
+            attributeRelationRecord.nodeName = addString(attributeRelation.second.nodeName);
+            attributeRelationRecord.environmentVariableName = addString(attributeRelation.second.environmentVariableName);
+            attributeRelationRecord.messageId = attributeRelation.second.messageId;
+            attributeRelationRecord.signalName = addString(attributeRelation.second.signalName);
+            attributeRelations.push_back(attributeRelationRecord);
+        }
+        record.attributeRelationValues = rangeFrom(attributeRelations, 0);
+
+        networks.push_back(record);
+    }
+
+    /** fill lookup tables, which are at most half full */
+    void addLookupTables() {
+        uint32_t slotCount = 0;
+        if (!messages.empty()) {
+            slotCount = 2;
+            while (slotCount < 2 * messages.size())
+                slotCount *= 2;
+        }
+        MessageIdSlot emptyIdSlot {};
+        emptyIdSlot.message = emptySlot;
+        messageIds.assign(slotCount, emptyIdSlot);
+        MessageNameSlot emptyNameSlot {};
+        emptyNameSlot.message = emptySlot;
+        messageNames.assign(slotCount, emptyNameSlot);
+
+        for (uint32_t message = 0; message < messages.size(); ++message) {
+            const MessageRecord & record = messages[message];
+
+            /* identifier */
+            uint32_t index = slotIndex(record.key, slotCount);
+            while (messageIds[index].message != emptySlot)
+                index = (index + 1) & (slotCount - 1);
+            messageIds[index].id = record.key;
+            messageIds[index].message = message;
+
+            /* name */
+            if (record.name.length == 0)
+                continue;
+            const uint32_t hash = nameHash(strings.data() + record.name.offset, record.name.length);
+            index = slotIndex(hash, slotCount);
+            while (messageNames[index].message != emptySlot)
+                index = (index + 1) & (slotCount - 1);
+            messageNames[index].hash = hash;
+            messageNames[index].message = message;
+        }
+    }
+};
+
+/** section data to write */
+struct SectionData {
+    /** Section Type */
+    SectionType type;
+
+    /** Data */
+    const void * data;
+
+    /** Number of records */
+    std::size_t count;
+};
+
+template<typename Record>
+static SectionData sectionData(const std::vector<Record> & records) {
+    return SectionData { Record::sectionType, records.data(), records.size() };
+}
+
+/**
+ * @brief Round up to section alignment
+ * @param[in] offset Offset
+ * @return Aligned offset
+ */
+static std::size_t align(std::size_t offset) {
+    return (offset + sectionAlignment - 1) & ~(sectionAlignment - 1);
+}
+
+bool saveSnapshot(const Network & network, std::ostream & ostream) {
+    /* collect records */
+    SnapshotWriter writer(network);
+    writer.addNetwork();
+    if (writer.overflow || (writer.messages.size() > std::numeric_limits<uint32_t>::max() / 4))
+        return false;
+    writer.addLookupTables();
+
+    const std::vector<SectionData> sections {
+        { SectionType::Strings, writer.strings.data(), writer.strings.size() },
+        sectionData(writer.stringLists),
+        sectionData(writer.networks),
+        sectionData(writer.nodes),
+        sectionData(writer.valueTables),
+        sectionData(writer.valueDescriptions),
+        sectionData(writer.messages),
+        sectionData(writer.signals),
+        sectionData(writer.signalGroups),
+        sectionData(writer.environmentVariables),
+        sectionData(writer.signalTypes),
+        sectionData(writer.attributeDefinitions),
+        sectionData(writer.attributes),
+        sectionData(writer.attributeRelations),
+        sectionData(writer.extendedMultiplexors),
+        sectionData(writer.valueRanges),
+        sectionData(writer.messageIds),
+        sectionData(writer.messageNames)
+    };
+
+    /* layout */
+    std::vector<Section> sectionTable;
+    std::size_t size = sizeof(Header) + sections.size() * sizeof(Section);
+    for (const SectionData & section : sections) {
+        size = align(size);
+        Section entry {};
+        entry.type = section.type;
+        entry.count = static_cast<uint32_t>(section.count);
+        entry.offset = size;
+        sectionTable.push_back(entry);
+        size += section.count * recordSize(section.type);
+    }
+
+    /* image */
+    std::string image(size, '\0');
+    Header header {};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.byteOrderMark = byteOrderMark;
+    header.version = version;
+    header.size = size;
+    header.sectionCount = static_cast<uint32_t>(sectionTable.size());
+    std::memcpy(&image[0], &header, sizeof(header));
+    std::memcpy(&image[sizeof(header)], sectionTable.data(), sectionTable.size() * sizeof(Section));
+    for (std::size_t i = 0; i < sections.size(); ++i) {
+        if (sections[i].count > 0)
+            std::memcpy(&image[sectionTable[i].offset], sections[i].data, sections[i].count * recordSize(sections[i].type));
+    }
+
+    ostream.write(image.data(), static_cast<std::streamsize>(image.size()));
+    return ostream.good();
+}
+
+bool saveSnapshot(const Network & network, const std::string & fileName) {
+    std::ofstream ofs(fileName, std::ofstream::binary);
+    if (!ofs.is_open())
+        return false;
+    return saveSnapshot(network, ofs) && ofs.flush().good();
+}
+
+/* loader */
+
+template<typename Container>
+static void loadStringList(const Snapshot & snapshot, Range range, Container & container) {
+    for (const String & string : snapshot.records<String>(range))
+        container.insert(container.end(), snapshot.string(string));
+}
+
+static void loadValueDescriptions(const Snapshot & snapshot, Range range, ValueDescriptions & valueDescriptions) {
+    for (const ValueDescriptionRecord & record : snapshot.records<ValueDescriptionRecord>(range))
+        valueDescriptions.emplace_hint(valueDescriptions.end(), record.value, snapshot.string(record.description));
+}
+
+/**
+ * @brief Load attribute
+ * @param[in] snapshot Snapshot
+ * @param[in] record Attribute record
+ * @param[in] network Network with attribute definitions
+ * @param[out] attribute Attribute
+ */
+static void loadAttribute(const Snapshot & snapshot, const AttributeRecord & record, const Network & network, Attribute & attribute) {
+    attribute.name = snapshot.string(record.name);
+    attribute.objectType = static_cast<AttributeObjectType>(record.objectType);
+    auto attributeDefinition = network.attributeDefinitions.find(attribute.name);
+    if ((attributeDefinition == network.attributeDefinitions.end()) ||
+            (attributeDefinition->second.valueType.type == AttributeValueType::Type::Float))
+        std::memcpy(&attribute.floatValue, &record.value, sizeof(record.value));
+    else
+        attribute.integerValue = static_cast<int32_t>(record.value);
+    attribute.stringValue = snapshot.string(record.stringValue);
+}
+
+static void loadAttributes(const Snapshot & snapshot, Range range, const Network & network, ArenaMap<Symbol, Attribute> & attributes) {
+    for (const AttributeRecord & record : snapshot.records<AttributeRecord>(range)) {
+        Attribute & attribute = attributes.emplace_hint(attributes.end(), snapshot.string(record.key), Attribute())->second;
+        loadAttribute(snapshot, record, network, attribute);
+    }
+}
+
+static void loadSignal(const Snapshot & snapshot, const SignalRecord & record, const Network & network, Signal & signal) {
+    signal.name = snapshot.string(record.name);
+    signal.multiplexor = static_cast<Signal::Multiplexor>(record.multiplexor);
+    signal.multiplexerSwitchValue = record.multiplexerSwitchValue;
+    signal.startBit = record.startBit;
+    signal.bitSize = record.bitSize;
+    signal.byteOrder = static_cast<ByteOrder>(record.byteOrder);
+    signal.valueType = static_cast<ValueType>(record.valueType);
+    signal.factor = record.factor;
+    signal.offset = record.offset;
+    signal.minimum = record.minimum;
+    signal.maximum = record.maximum;
+    signal.unit = snapshot.string(record.unit);
+    loadStringList(snapshot, record.receivers, signal.receivers);
+    signal.extendedValueType = static_cast<Signal::ExtendedValueType>(record.extendedValueType);
+    loadValueDescriptions(snapshot, record.valueDescriptions, signal.valueDescriptions);
+    signal.type = snapshot.string(record.type);
+    signal.comment = snapshot.string(record.comment);
+    loadAttributes(snapshot, record.attributeValues, network, signal.attributeValues);
+    for (const ExtendedMultiplexorRecord & extendedMultiplexorRecord : snapshot.records<ExtendedMultiplexorRecord>(record.extendedMultiplexors)) {
+        ExtendedMultiplexor & extendedMultiplexor = signal.extendedMultiplexors.emplace_hint(
+            signal.extendedMultiplexors.end(), snapshot.string(extendedMultiplexorRecord.key), ExtendedMultiplexor())->second;
+        extendedMultiplexor.switchName = snapshot.string(extendedMultiplexorRecord.switchName);
+        for (const ValueRangeRecord & valueRangeRecord : snapshot.records<ValueRangeRecord>(extendedMultiplexorRecord.valueRanges))
+            extendedMultiplexor.valueRanges.emplace_hint(extendedMultiplexor.valueRanges.end(), valueRangeRecord.minimum, valueRangeRecord.maximum);
+    }
+}
+
+static void loadMessage(const Snapshot & snapshot, const MessageRecord & record, const Network & network, Message & message) {
+    message.id = record.id;
+    message.name = snapshot.string(record.name);
+    message.size = record.size;
+    message.transmitter = snapshot.string(record.transmitter);
+    for (const SignalRecord & signalRecord : snapshot.records<SignalRecord>(record.signals)) {
+        Signal & signal = message.signals.emplace_hint(message.signals.end(), snapshot.string(signalRecord.key), Signal())->second;
+        loadSignal(snapshot, signalRecord, network, signal);
+    }
+    loadStringList(snapshot, record.transmitters, message.transmitters);
+    for (const SignalGroupRecord & signalGroupRecord : snapshot.records<SignalGroupRecord>(record.signalGroups)) {
+        SignalGroup & signalGroup = message.signalGroups.emplace_hint(message.signalGroups.end(), snapshot.string(signalGroupRecord.key), SignalGroup())->second;
+        signalGroup.messageId = signalGroupRecord.messageId;
+        signalGroup.name = snapshot.string(signalGroupRecord.name);
+        signalGroup.repetitions = signalGroupRecord.repetitions;
+        loadStringList(snapshot, signalGroupRecord.signals, signalGroup.signals);
+    }
+    message.comment = snapshot.string(record.comment);
+    loadAttributes(snapshot, record.attributeValues, network, message.attributeValues);
+}
+
+static void loadEnvironmentVariable(const Snapshot & snapshot, const EnvironmentVariableRecord & record, const Network & network, EnvironmentVariable & environmentVariable) {
+    environmentVariable.name = snapshot.string(record.name);
+    environmentVariable.type = static_cast<EnvironmentVariable::Type>(record.type);
+    environmentVariable.minimum = record.minimum;
+    environmentVariable.maximum = record.maximum;
+    environmentVariable.unit = snapshot.string(record.unit);
+    environmentVariable.initialValue = record.initialValue;
+    environmentVariable.id = record.id;
+    environmentVariable.accessType = static_cast<EnvironmentVariable::AccessType>(record.accessType);
+    loadStringList(snapshot, record.accessNodes, environmentVariable.accessNodes);
+    loadValueDescriptions(snapshot, record.valueDescriptions, environmentVariable.valueDescriptions);
+    environmentVariable.dataSize = record.dataSize;
+    environmentVariable.comment = snapshot.string(record.comment);
+    loadAttributes(snapshot, record.attributeValues, network, environmentVariable.attributeValues);
+}
+
+static void loadSignalType(const Snapshot & snapshot, const SignalTypeRecord & record, SignalType & signalType) {
+    signalType.name = snapshot.string(record.name);
+    signalType.size = record.size;
+    signalType.byteOrder = static_cast<ByteOrder>(record.byteOrder);
+    signalType.valueType = static_cast<ValueType>(record.valueType);
+    signalType.factor = record.factor;
+    signalType.offset = record.offset;
+    signalType.minimum = record.minimum;
+    signalType.maximum = record.maximum;
+    signalType.unit = snapshot.string(record.unit);
+    signalType.defaultValue = record.defaultValue;
+    signalType.valueTable = snapshot.string(record.valueTable);
+}
+
+static void loadAttributeDefinition(const Snapshot & snapshot, const AttributeDefinitionRecord & record, AttributeDefinition & attributeDefinition) {
+    attributeDefinition.name = snapshot.string(record.name);
+    attributeDefinition.objectType = static_cast<AttributeObjectType>(record.objectType);
+    AttributeValueType & valueType = attributeDefinition.valueType;
+    valueType.type = static_cast<AttributeValueType::Type>(record.valueType);
+    switch (valueType.type) {
+    case AttributeValueType::Type::Int:
+        valueType.integerValue.minimum = static_cast<int32_t>(record.minimumMaximum[0]);
+        valueType.integerValue.maximum = static_cast<int32_t>(record.minimumMaximum[1]);
+        break;
+    case AttributeValueType::Type::Hex:
+        valueType.hexValue.minimum = static_cast<int32_t>(record.minimumMaximum[0]);
+        valueType.hexValue.maximum = static_cast<int32_t>(record.minimumMaximum[1]);
+        break;
+    case AttributeValueType::Type::Float:
+        std::memcpy(&valueType.floatValue.minimum, &record.minimumMaximum[0], sizeof(uint64_t));
+        std::memcpy(&valueType.floatValue.maximum, &record.minimumMaximum[1], sizeof(uint64_t));
+        break;
+    case AttributeValueType::Type::String:
+    case AttributeValueType::Type::Enum:
+        break;
+    }
+    loadStringList(snapshot, record.enumValues, valueType.enumValues);
+}
+
+/**
+ * @brief Load network from snapshot
+ * @param[in] snapshot Opened snapshot
+ * @param[out] network Empty network
+ */
+static void loadNetwork(const Snapshot & snapshot, Network & network) {
+    const NetworkRecord & record = snapshot.records<NetworkRecord>()[0];
+    network.version = snapshot.string(record.version);
+    loadStringList(snapshot, record.newSymbols, network.newSymbols);
+    network.bitTiming.baudrate = record.baudrate;
+    network.bitTiming.btr1 = record.btr1;
+    network.bitTiming.btr2 = record.btr2;
+
+    /* attribute definitions first, as attribute values depend on their value type */
+    for (const AttributeDefinitionRecord & attributeDefinitionRecord : snapshot.records<AttributeDefinitionRecord>(record.attributeDefinitions)) {
+        AttributeDefinition & attributeDefinition = network.attributeDefinitions.emplace_hint(
+            network.attributeDefinitions.end(), snapshot.string(attributeDefinitionRecord.key), AttributeDefinition())->second;
+        loadAttributeDefinition(snapshot, attributeDefinitionRecord, attributeDefinition);
+    }
+
+    for (const NodeRecord & nodeRecord : snapshot.records<NodeRecord>(record.nodes)) {
+        Node & node = network.nodes.emplace_hint(network.nodes.end(), snapshot.string(nodeRecord.key), Node())->second;
+        node.name = snapshot.string(nodeRecord.name);
+        node.comment = snapshot.string(nodeRecord.comment);
+        loadAttributes(snapshot, nodeRecord.attributeValues, network, node.attributeValues);
+    }
+    for (const ValueTableRecord & valueTableRecord : snapshot.records<ValueTableRecord>(record.valueTables)) {
+        ValueTable & valueTable = network.valueTables.emplace_hint(network.valueTables.end(), snapshot.string(valueTableRecord.key), ValueTable())->second;
+        valueTable.name = snapshot.string(valueTableRecord.name);
+        loadValueDescriptions(snapshot, valueTableRecord.valueDescriptions, valueTable.valueDescriptions);
+    }
+    for (const MessageRecord & messageRecord : snapshot.records<MessageRecord>(record.messages)) {
+        Message & message = network.messages.emplace_hint(network.messages.end(), messageRecord.key, Message())->second;
+        loadMessage(snapshot, messageRecord, network, message);
+    }
+    for (const EnvironmentVariableRecord & environmentVariableRecord : snapshot.records<EnvironmentVariableRecord>(record.environmentVariables)) {
+        EnvironmentVariable & environmentVariable = network.environmentVariables.emplace_hint(
+            network.environmentVariables.end(), snapshot.string(environmentVariableRecord.key), EnvironmentVariable())->second;
+        loadEnvironmentVariable(snapshot, environmentVariableRecord, network, environmentVariable);
+    }
+    for (const SignalTypeRecord & signalTypeRecord : snapshot.records<SignalTypeRecord>(record.signalTypes)) {
+        SignalType & signalType = network.signalTypes.emplace_hint(network.signalTypes.end(), snapshot.string(signalTypeRecord.key), SignalType())->second;
+        loadSignalType(snapshot, signalTypeRecord, signalType);
+    }
+    network.comment = snapshot.string(record.comment);
+    loadAttributes(snapshot, record.attributeDefaults, network, network.attributeDefaults);
+    loadAttributes(snapshot, record.attributeValues, network, network.attributeValues);
+    for (const AttributeRelationRecord & attributeRelationRecord : snapshot.records<AttributeRelationRecord>(record.attributeRelationValues)) {
+        AttributeRelation & attributeRelation = network.attributeRelationValues.emplace_hint(
+            network.attributeRelationValues.end(), snapshot.string(attributeRelationRecord.attribute.key), AttributeRelation())->second;
+        loadAttribute(snapshot, attributeRelationRecord.attribute, network, attributeRelation);
+        attributeRelation.nodeName = snapshot.string(attributeRelationRecord.nodeName);
+        attributeRelation.environmentVariableName = snapshot.string(attributeRelationRecord.environmentVariableName);
+        attributeRelation.messageId = attributeRelationRecord.messageId;
+        attributeRelation.signalName = snapshot.string(attributeRelationRecord.signalName);
+    }
+}
+
+bool loadSnapshot(Network & network, const char * data, std::size_t size) {
+    Snapshot snapshot;
+    if (!snapshot.open(data, size)) {
+        network.successfullyParsed = false;
+        return false;
+    }
+
+    Network result;
+    loadNetwork(snapshot, result);
+    result.successfullyParsed = true;
+    network = std::move(result);
+    return true;
+}
+
+bool loadSnapshot(Network & network, const std::string & fileName) {
+    /* map file */
+    MappedFile mappedFile(fileName);
+    if (!mappedFile.isOpen()) {
+        network.successfullyParsed = false;
+        return false;
+    }
+
+    return loadSnapshot(network, mappedFile.data(), mappedFile.size());
+}
+
+}
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <Vector/DBC/Network.h>
+#include <Vector/DBC/SnapshotFormat.h>
+#include <Vector/DBC/Span.h>
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Snapshot
+ *
+ * Read access to a snapshot (see SnapshotFormat) in memory, e.g. in a
+ * MappedFile. open() checks the header, the section table and that all
+ * strings and ranges are within their sections, so records can be used
+ * afterwards without further checks. The data isn't copied and must
+ * stay valid while the snapshot is used.
+ */
+class VECTOR_DBC_EXPORT Snapshot {
+  public:
+    /**
+     * @brief Open snapshot
+     * @param[in] data Snapshot data (aligned to 8 bytes)
+     * @param[in] size Size of data
+     * @return true if the snapshot is valid (otherwise all sections are empty)
+     */
+    bool open(const char * data, std::size_t size);
+
+    /**
+     * @brief Check if a valid snapshot was opened
+     * @return true if snapshot is open
+     */
+    bool isOpen() const {
+        return opened;
+    }
+
+    /**
+     * @brief Get all records of a section
+     * @return Records
+     */
+    template<typename Record>
+    Span<const Record> records() const {
+        const std::size_t type = static_cast<std::size_t>(Record::sectionType);
+        return Span<const Record>(reinterpret_cast<const Record *>(sectionData[type]), sectionCount[type]);
+    }
+
+    /**
+     * @brief Get range of records of a section
+     * @param[in] range Range
+     * @return Records
+     */
+    template<typename Record>
+    Span<const Record> records(SnapshotFormat::Range range) const {
+        return Span<const Record>(records<Record>().data() + range.first, range.count);
+    }
+
+    /**
+     * @brief Get character data of all strings
+     * @return Strings section
+     */
+    Span<const char> strings() const {
+        const std::size_t type = static_cast<std::size_t>(SnapshotFormat::SectionType::Strings);
+        return Span<const char>(sectionData[type], sectionCount[type]);
+    }
+
+    /**
+     * @brief Get string
+     * @param[in] value String reference
+     * @return String
+     */
+    std::string string(SnapshotFormat::String value) const {
+        return std::string(strings().data() + value.offset, value.length);
+    }
+
+    /**
+     * @brief Get string in place
+     * @param[in] value String reference
+     * @return String View
+     */
+    StringView stringView(SnapshotFormat::String value) const {
+        return StringView(strings().data() + value.offset, value.length);
+    }
+
+  private:
+    /**
+     * @brief Check snapshot and fill section table
+     * @param[in] data Snapshot data
+     * @param[in] size Size of data
+     * @return true if the snapshot is valid
+     */
+    bool validate(const char * data, std::size_t size);
+
+    /** section data, indexed by section type */
+    std::array<const char *, SnapshotFormat::sectionTypeCount> sectionData {};
+
+    /** number of records, indexed by section type */
+    std::array<uint32_t, SnapshotFormat::sectionTypeCount> sectionCount {};
+
+    /** valid snapshot was opened */
+    bool opened {};
+};
+
+/**
+ * @brief Save network as snapshot
+ * @param[in] network Network
+ * @param[in] ostream Output stream (binary)
+ * @return true if the snapshot was written
+ */
+VECTOR_DBC_EXPORT bool saveSnapshot(const Network & network, std::ostream & ostream);
+
+/**
+ * @brief Save network as snapshot file
+ * @param[in] network Network
+ * @param[in] fileName File name
+ * @return true if the snapshot was written
+ */
+VECTOR_DBC_EXPORT bool saveSnapshot(const Network & network, const std::string & fileName);
+
+/**
+ * @brief Load network from snapshot in memory
+ * @param[out] network Network
+ * @param[in] data Snapshot data (aligned to 8 bytes)
+ * @param[in] size Size of data
+ * @return true if the snapshot is valid
+ *
+ * The network is replaced. Invalid snapshots leave it unchanged,
+ * except that successfullyParsed is cleared.
+ */
+VECTOR_DBC_EXPORT bool loadSnapshot(Network & network, const char * data, std::size_t size);
+
+/**
+ * @brief Load network from snapshot file
+ * @param[out] network Network
+ * @param[in] fileName File name
+ * @return true if the file was read and is a valid snapshot
+ *
+ * The file is memory mapped, see loadSnapshot for data in memory.
+ */
+VECTOR_DBC_EXPORT bool loadSnapshot(Network & network, const std::string & fileName);
+
+}
+}
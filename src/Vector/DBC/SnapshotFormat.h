@@ -0,0 +1,686 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Snapshot File Format
+ *
+ * A snapshot is a binary image of a Network, which can be memory mapped
+ * and read without parsing. It starts with a Header, followed by a table
+ * of Section entries. Each section is an array of fixed size records,
+ * aligned to 8 bytes. Records refer to other records by index (Range)
+ * and to names by offset into the string section (String), never by
+ * pointer. Equal strings are stored once. Lookup tables for messages by
+ * identifier and name are embedded, so that a snapshot can be used in
+ * place (see NetworkView).
+ *
+ * Records of maps are stored in the order of the map, so keys are sorted.
+ * The key is stored beside the record, as the parser may create map
+ * entries, e.g. for comments, before or without their definition.
+ *
+ * All values are in host byte order. The header's byte order mark
+ * rejects snapshots of hosts with other byte order.
+ */
+namespace SnapshotFormat {
+
+/** Magic */
+constexpr char magic[8] { 'V', 'D', 'B', 'C', 'S', 'N', 'A', 'P' };
+
+/** Byte Order Mark */
+constexpr uint32_t byteOrderMark = 0x01020304;
+
+/** Version (2 added the MessageIds and MessageNames sections) */
+constexpr uint32_t version = 2;
+
+/** Section Type */
+enum class SectionType : uint32_t {
+    /** Character data of all strings */
+    Strings = 1,
+
+    /** String lists (String) */
+    StringLists,
+
+    /** Network (NetworkRecord, exactly one) */
+    Network,
+
+    /** Nodes (NodeRecord) */
+    Nodes,
+
+    /** Value Tables (ValueTableRecord) */
+    ValueTables,
+
+    /** Value Descriptions (ValueDescriptionRecord) */
+    ValueDescriptions,
+
+    /** Messages (MessageRecord) */
+    Messages,
+
+    /** Signals (SignalRecord) */
+    Signals,
+
+    /** Signal Groups (SignalGroupRecord) */
+    SignalGroups,
+
+    /** Environment Variables (EnvironmentVariableRecord) */
+    EnvironmentVariables,
+
+    /** Signal Types (SignalTypeRecord) */
+    SignalTypes,
+
+    /** Attribute Definitions (AttributeDefinitionRecord) */
+    AttributeDefinitions,
+
+    /** Attributes (AttributeRecord) */
+    Attributes,
+
+    /** Attribute Relations (AttributeRelationRecord) */
+    AttributeRelations,
+
+    /** Extended Multiplexors (ExtendedMultiplexorRecord) */
+    ExtendedMultiplexors,
+
+    /** Value Ranges (ValueRangeRecord) */
+    ValueRanges,
+
+    /** Message lookup by identifier (MessageIdSlot) */
+    MessageIds,
+
+    /** Message lookup by name (MessageNameSlot) */
+    MessageNames
+};
+
+/** Number of section types (including the unused type 0) */
+constexpr std::size_t sectionTypeCount = static_cast<std::size_t>(SectionType::MessageNames) + 1;
+
+/** Header */
+struct Header {
+    /** Magic */
+    char magic[8];
+
+    /** Byte Order Mark */
+    uint32_t byteOrderMark;
+
+    /** Version */
+    uint32_t version;
+
+    /** File Size */
+    uint64_t size;
+
+    /** Number of Section entries following the header */
+    uint32_t sectionCount;
+
+    /** reserved */
+    uint32_t reserved;
+};
+
+/** Section */
+struct Section {
+    /** Section Type */
+    SectionType type;
+
+    /** Number of records (bytes for strings) */
+    uint32_t count;
+
+    /** Offset from start of file */
+    uint64_t offset;
+};
+
+/** String (offset and length in string section) */
+struct String {
+    /** Section of string lists */
+    static constexpr SectionType sectionType = SectionType::StringLists;
+
+    /** Offset */
+    uint32_t offset;
+
+    /** Length */
+    uint32_t length;
+};
+
+/** Range of records (index of first record and number of records) */
+struct Range {
+    /** First Record */
+    uint32_t first;
+
+    /** Number of Records */
+    uint32_t count;
+};
+
+/** Network (Network) */
+struct NetworkRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::Network;
+
+    /** Version (VERSION) */
+    String version;
+
+    /** Comment (CM) */
+    String comment;
+
+    /** Baudrate (BS) */
+    uint32_t baudrate;
+
+    /** BTR1 (BS) */
+    uint32_t btr1;
+
+    /** BTR2 (BS) */
+    uint32_t btr2;
+
+    /** reserved */
+    uint32_t reserved;
+
+    /** New Symbols (NS) in StringLists */
+    Range newSymbols;
+
+    /** Nodes (BU) in Nodes */
+    Range nodes;
+
+    /** Value Tables (VAL_TABLE) in ValueTables */
+    Range valueTables;
+
+    /** Messages (BO) in Messages */
+    Range messages;
+
+    /** Environment Variables (EV) in EnvironmentVariables */
+    Range environmentVariables;
+
+    /** Signal Types (SGTYPE) in SignalTypes */
+    Range signalTypes;
+
+    /** Attribute Definitions (BA_DEF, BA_DEF_REL) in AttributeDefinitions */
+    Range attributeDefinitions;
+
+    /** Attribute Defaults (BA_DEF_DEF, BA_DEF_DEF_REL) in Attributes */
+    Range attributeDefaults;
+
+    /** Attribute Values (BA) in Attributes */
+    Range attributeValues;
+
+    /** Attribute Values on Relations (BA_REL) in AttributeRelations */
+    Range attributeRelationValues;
+};
+
+/** Node (Node) */
+struct NodeRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::Nodes;
+
+    /** Key in Network::nodes */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Comment (CM) */
+    String comment;
+
+    /** Attribute Values (BA) in Attributes */
+    Range attributeValues;
+};
+
+/** Value Table (ValueTable) */
+struct ValueTableRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::ValueTables;
+
+    /** Key in Network::valueTables */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Value Descriptions in ValueDescriptions */
+    Range valueDescriptions;
+};
+
+/** Value Description (ValueDescriptions entry) */
+struct ValueDescriptionRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::ValueDescriptions;
+
+    /** Value */
+    uint32_t value;
+
+    /** Description */
+    String description;
+};
+
+/** Message (Message) */
+struct MessageRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::Messages;
+
+    /** Key in Network::messages */
+    uint32_t key;
+
+    /** Identifier (with bit 31 set this is extended CAN frame) */
+    uint32_t id;
+
+    /** Name */
+    String name;
+
+    /** Size */
+    uint32_t size;
+
+    /** reserved */
+    uint32_t reserved;
+
+    /** Transmitter */
+    String transmitter;
+
+    /** Comment (CM) */
+    String comment;
+
+    /** Signals (SG) in Signals */
+    Range signals;
+
+    /** Message Transmitters (BO_TX_BU) in StringLists */
+    Range transmitters;
+
+    /** Signal Groups (SIG_GROUP) in SignalGroups */
+    Range signalGroups;
+
+    /** Attribute Values (BA) in Attributes */
+    Range attributeValues;
+};
+
+/** Signal (Signal) */
+struct SignalRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::Signals;
+
+    /** Key in Message::signals */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Start Bit */
+    uint32_t startBit;
+
+    /** Bit Size */
+    uint32_t bitSize;
+
+    /** Multiplexer Switch Value */
+    uint32_t multiplexerSwitchValue;
+
+    /** Multiplexor (Signal::Multiplexor) */
+    uint8_t multiplexor;
+
+    /** Byte Order (ByteOrder) */
+    uint8_t byteOrder;
+
+    /** Value Type (ValueType) */
+    uint8_t valueType;
+
+    /** Extended Value Type (Signal::ExtendedValueType, SIG_VALTYPE) */
+    uint8_t extendedValueType;
+
+    /** Factor */
+    double factor;
+
+    /** Offset */
+    double offset;
+
+    /** Minimum Physical Value */
+    double minimum;
+
+    /** Maximum Physical Value */
+    double maximum;
+
+    /** Unit */
+    String unit;
+
+    /** Signal Type (SGTYPE) */
+    String type;
+
+    /** Comment (CM) */
+    String comment;
+
+    /** Receivers in StringLists */
+    Range receivers;
+
+    /** Value Descriptions (VAL) in ValueDescriptions */
+    Range valueDescriptions;
+
+    /** Attribute Values (BA) in Attributes */
+    Range attributeValues;
+
+    /** Extended Multiplexors (SG_MUL_VAL) in ExtendedMultiplexors */
+    Range extendedMultiplexors;
+};
+
+/** Signal Group (SignalGroup) */
+struct SignalGroupRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::SignalGroups;
+
+    /** Key in Message::signalGroups */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Message Identifier */
+    uint32_t messageId;
+
+    /** Repetitions */
+    uint32_t repetitions;
+
+    /** Signal Names in StringLists */
+    Range signals;
+};
+
+/** Environment Variable (EnvironmentVariable) */
+struct EnvironmentVariableRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::EnvironmentVariables;
+
+    /** Key in Network::environmentVariables */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Type (EnvironmentVariable::Type) */
+    uint8_t type;
+
+    /** reserved */
+    uint8_t reserved;
+
+    /** Access Type (EnvironmentVariable::AccessType) */
+    uint16_t accessType;
+
+    /** Identifier */
+    uint32_t id;
+
+    /** Minimum */
+    double minimum;
+
+    /** Maximum */
+    double maximum;
+
+    /** Initial Value */
+    double initialValue;
+
+    /** Unit */
+    String unit;
+
+    /** Comment (CM) */
+    String comment;
+
+    /** Data Size (ENVVAR_DATA) */
+    uint32_t dataSize;
+
+    /** reserved */
+    uint32_t reserved2;
+
+    /** Access Nodes in StringLists */
+    Range accessNodes;
+
+    /** Value Descriptions (VAL) in ValueDescriptions */
+    Range valueDescriptions;
+
+    /** Attribute Values (BA) in Attributes */
+    Range attributeValues;
+};
+
+/** Signal Type (SignalType) */
+struct SignalTypeRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::SignalTypes;
+
+    /** Key in Network::signalTypes */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Size */
+    uint32_t size;
+
+    /** Byte Order (ByteOrder) */
+    uint8_t byteOrder;
+
+    /** Value Type (ValueType) */
+    uint8_t valueType;
+
+    /** reserved */
+    uint16_t reserved;
+
+    /** Factor */
+    double factor;
+
+    /** Offset */
+    double offset;
+
+    /** Minimum */
+    double minimum;
+
+    /** Maximum */
+    double maximum;
+
+    /** Default Value */
+    double defaultValue;
+
+    /** Unit */
+    String unit;
+
+    /** Value Table */
+    String valueTable;
+};
+
+/** Attribute Definition (AttributeDefinition) */
+struct AttributeDefinitionRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::AttributeDefinitions;
+
+    /** Key in Network::attributeDefinitions */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Object Type (AttributeObjectType) */
+    uint32_t objectType;
+
+    /** Value Type (AttributeValueType::Type) */
+    uint32_t valueType;
+
+    /** Minimum and Maximum (bits of the AttributeValueType value union) */
+    uint64_t minimumMaximum[2];
+
+    /** Enum Values in StringLists */
+    Range enumValues;
+};
+
+/** Attribute (Attribute) */
+struct AttributeRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::Attributes;
+
+    /** Key in the attribute map */
+    String key;
+
+    /** Name */
+    String name;
+
+    /** Object Type (AttributeObjectType) */
+    uint32_t objectType;
+
+    /** reserved */
+    uint32_t reserved;
+
+    /** Value (bits of the Attribute value union) */
+    uint64_t value;
+
+    /** String Value */
+    String stringValue;
+};
+
+/** Attribute Relation (AttributeRelation) */
+struct AttributeRelationRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::AttributeRelations;
+
+    /** Attribute */
+    AttributeRecord attribute;
+
+    /** Node Name */
+    String nodeName;
+
+    /** Environment Variable Name */
+    String environmentVariableName;
+
+    /** Message Identifier */
+    uint32_t messageId;
+
+    /** reserved */
+    uint32_t reserved;
+
+    /** Signal Name */
+    String signalName;
+};
+
+/** Extended Multiplexor (ExtendedMultiplexor) */
+struct ExtendedMultiplexorRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::ExtendedMultiplexors;
+
+    /** Key in Signal::extendedMultiplexors */
+    String key;
+
+    /** Switch Name */
+    String switchName;
+
+    /** Value Ranges in ValueRanges */
+    Range valueRanges;
+};
+
+/** Value Range (ExtendedMultiplexor::ValueRange) */
+struct ValueRangeRecord {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::ValueRanges;
+
+    /** Minimum */
+    uint32_t minimum;
+
+    /** Maximum */
+    uint32_t maximum;
+};
+
+/** Marks empty lookup slots */
+constexpr uint32_t emptySlot = UINT32_MAX;
+
+/**
+ * Message Identifier Lookup Slot
+ *
+ * Lookup tables are open-addressing hash tables with linear probing,
+ * with a power of two many slots and at least one empty slot. The
+ * search starts at slotIndex(id). Sections without slots mean that
+ * there is no lookup table.
+ */
+struct MessageIdSlot {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::MessageIds;
+
+    /** Key of message in Network::messages */
+    uint32_t id;
+
+    /** Index in Messages (emptySlot if empty) */
+    uint32_t message;
+};
+
+/**
+ * Message Name Lookup Slot
+ *
+ * The search starts at slotIndex(nameHash(name)). Messages without
+ * name aren't in the table. On equal names the first message wins.
+ */
+struct MessageNameSlot {
+    /** Section of these records */
+    static constexpr SectionType sectionType = SectionType::MessageNames;
+
+    /** nameHash of message name */
+    uint32_t hash;
+
+    /** Index in Messages (emptySlot if empty) */
+    uint32_t message;
+};
+
+/**
+ * @brief Hash of a name (FNV-1a)
+ * @param[in] data Name
+ * @param[in] size Size of name
+ * @return Hash
+ */
+inline uint32_t nameHash(const char * data, std::size_t size) {
+    uint32_t hash = UINT32_C(2166136261);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= UINT32_C(16777619);
+    }
+    return hash;
+}
+
+/**
+ * @brief First slot to search for a key
+ * @param[in] key Identifier or name hash
+ * @param[in] slotCount Number of slots (power of two)
+ * @return Slot index
+ */
+inline uint32_t slotIndex(uint32_t key, uint32_t slotCount) {
+    /* Fibonacci hashing, which spreads consecutive identifiers */
+    return static_cast<uint32_t>((uint64_t(key * UINT32_C(2654435769)) * slotCount) >> 32);
+}
+
+/* records have no implicit padding, so snapshots are reproducible */
+static_assert(sizeof(Header) == 32, "unexpected padding");
+static_assert(sizeof(Section) == 16, "unexpected padding");
+static_assert(sizeof(NetworkRecord) == 112, "unexpected padding");
+static_assert(sizeof(NodeRecord) == 32, "unexpected padding");
+static_assert(sizeof(ValueTableRecord) == 24, "unexpected padding");
+static_assert(sizeof(ValueDescriptionRecord) == 12, "unexpected padding");
+static_assert(sizeof(MessageRecord) == 72, "unexpected padding");
+static_assert(sizeof(SignalRecord) == 120, "unexpected padding");
+static_assert(sizeof(SignalGroupRecord) == 32, "unexpected padding");
+static_assert(sizeof(EnvironmentVariableRecord) == 96, "unexpected padding");
+static_assert(sizeof(SignalTypeRecord) == 80, "unexpected padding");
+static_assert(sizeof(AttributeDefinitionRecord) == 48, "unexpected padding");
+static_assert(sizeof(AttributeRecord) == 40, "unexpected padding");
+static_assert(sizeof(AttributeRelationRecord) == 72, "unexpected padding");
+static_assert(sizeof(ExtendedMultiplexorRecord) == 24, "unexpected padding");
+static_assert(sizeof(ValueRangeRecord) == 8, "unexpected padding");
+static_assert(sizeof(MessageIdSlot) == 8, "unexpected padding");
+static_assert(sizeof(MessageNameSlot) == 8, "unexpected padding");
+
+}
+}
+}
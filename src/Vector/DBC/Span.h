@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Span
+ *
+ * Non-owning view on contiguous data, like std::span in C++20.
+ * It can be created from pointer and size, C arrays, std::array and
+ * std::vector, so data can be used in place without copying it.
+ */
+template<typename T>
+class Span {
+  public:
+    /** Element Type */
+    using element_type = T;
+
+    /** Value Type */
+    using value_type = typename std::remove_cv<T>::type;
+
+    /** Iterator */
+    using iterator = T *;
+
+    constexpr Span() noexcept = default;
+
+    /**
+     * @brief Create span from pointer and size
+     * @param[in] data Data
+     * @param[in] size Size
+     */
+    constexpr Span(T * data, std::size_t size) noexcept :
+        elements(data),
+        elementCount(size) {
+    }
+
+    /**
+     * @brief Create span from C array
+     * @param[in] array Array
+     */
+    template<std::size_t N>
+    constexpr Span(T (&array)[N]) noexcept :
+        elements(array),
+        elementCount(N) {
+    }
+
+    /**
+     * @brief Create span from std::array
+     * @param[in] array Array
+     */
+    template<std::size_t N>
+    constexpr Span(std::array<value_type, N> & array) noexcept :
+        elements(array.data()),
+        elementCount(N) {
+    }
+
+    /**
+     * @brief Create span from const std::array
+     * @param[in] array Array
+     */
+    template<std::size_t N, typename U = T, typename = typename std::enable_if<std::is_const<U>::value>::type>
+    constexpr Span(const std::array<value_type, N> & array) noexcept :
+        elements(array.data()),
+        elementCount(N) {
+    }
+
+    /**
+     * @brief Create span from std::vector
+     * @param[in] vector Vector
+     */
+    Span(std::vector<value_type> & vector) noexcept :
+        elements(vector.data()),
+        elementCount(vector.size()) {
+    }
+
+    /**
+     * @brief Create span from const std::vector
+     * @param[in] vector Vector
+     */
+    template<typename U = T, typename = typename std::enable_if<std::is_const<U>::value>::type>
+    Span(const std::vector<value_type> & vector) noexcept :
+        elements(vector.data()),
+        elementCount(vector.size()) {
+    }
+
+    /**
+     * @brief Create const span from non-const span
+     * @param[in] span Span
+     */
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>
+    constexpr Span(const Span<U> & span) noexcept :
+        elements(span.data()),
+        elementCount(span.size()) {
+    }
+
+    /**
+     * @brief Get data
+     * @return Data
+     */
+    constexpr T * data() const noexcept {
+        return elements;
+    }
+
+    /**
+     * @brief Get size
+     * @return Size
+     */
+    constexpr std::size_t size() const noexcept {
+        return elementCount;
+    }
+
+    /**
+     * @brief Check if span is empty
+     * @return true if span is empty
+     */
+    constexpr bool empty() const noexcept {
+        return elementCount == 0;
+    }
+
+    /**
+     * @brief Get element
+     * @param[in] index Index
+     * @return Element
+     */
+    constexpr T & operator[](std::size_t index) const noexcept {
+        return elements[index];
+    }
+
+    /**
+     * @brief Get begin
+     * @return Iterator to first element
+     */
+    constexpr iterator begin() const noexcept {
+        return elements;
+    }
+
+    /**
+     * @brief Get end
+     * @return Iterator behind last element
+     */
+    constexpr iterator end() const noexcept {
+        return elements + elementCount;
+    }
+
+  private:
+    /** Data */
+    T * elements {};
+
+    /** Size */
+    std::size_t elementCount {};
+};
+
+}
+}
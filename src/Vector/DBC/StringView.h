@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * String View
+ *
+ * Non-owning view on character data, like std::string_view in C++17.
+ * It's used to read strings in place, e.g. from a memory mapped
+ * snapshot, without copying them into a std::string.
+ */
+class StringView {
+  public:
+    /** Iterator */
+    using iterator = const char *;
+
+    constexpr StringView() noexcept = default;
+
+    /**
+     * @brief Create view from pointer and size
+     * @param[in] data Data
+     * @param[in] size Size
+     */
+    constexpr StringView(const char * data, std::size_t size) noexcept :
+        characters(data),
+        characterCount(size) {
+    }
+
+    /**
+     * @brief Create view from null terminated string
+     * @param[in] string String
+     */
+    StringView(const char * string) noexcept :
+        characters(string),
+        characterCount(std::strlen(string)) {
+    }
+
+    /**
+     * @brief Create view from std::string
+     * @param[in] string String
+     */
+    StringView(const std::string & string) noexcept :
+        characters(string.data()),
+        characterCount(string.size()) {
+    }
+
+    /**
+     * @brief Get data (not null terminated)
+     * @return Data
+     */
+    constexpr const char * data() const noexcept {
+        return characters;
+    }
+
+    /**
+     * @brief Get size
+     * @return Size
+     */
+    constexpr std::size_t size() const noexcept {
+        return characterCount;
+    }
+
+    /**
+     * @brief Check if view is empty
+     * @return true if view is empty
+     */
+    constexpr bool empty() const noexcept {
+        return characterCount == 0;
+    }
+
+    /**
+     * @brief Get character
+     * @param[in] index Index
+     * @return Character
+     */
+    constexpr char operator[](std::size_t index) const noexcept {
+        return characters[index];
+    }
+
+    /**
+     * @brief Get begin
+     * @return Iterator to first character
+     */
+    constexpr iterator begin() const noexcept {
+        return characters;
+    }
+
+    /**
+     * @brief Get end
+     * @return Iterator behind last character
+     */
+    constexpr iterator end() const noexcept {
+        return characters + characterCount;
+    }
+
+    /**
+     * @brief Copy into std::string
+     * @return String
+     */
+    std::string toString() const {
+        return std::string(characters, characterCount);
+    }
+
+    /**
+     * @brief Compare like std::string::compare
+     * @param[in] other Other view
+     * @return <0, 0 or >0, if this is less, equal or greater than other
+     */
+    int compare(StringView other) const noexcept {
+        const std::size_t size = std::min(characterCount, other.characterCount);
+        const int result = (size == 0) ? 0 : std::memcmp(characters, other.characters, size);
+        if (result != 0)
+            return result;
+        if (characterCount == other.characterCount)
+            return 0;
+        return (characterCount < other.characterCount) ? -1 : 1;
+    }
+
+  private:
+    /** Data */
+    const char * characters {};
+
+    /** Size */
+    std::size_t characterCount {};
+};
+
+inline bool operator==(StringView lhs, StringView rhs) noexcept {
+    return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+}
+
+inline bool operator!=(StringView lhs, StringView rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator<(StringView lhs, StringView rhs) noexcept {
+    return lhs.compare(rhs) < 0;
+}
+
+inline std::ostream & operator<<(std::ostream & os, StringView stringView) {
+    return os.write(stringView.data(), static_cast<std::streamsize>(stringView.size()));
+}
+
+}
+}
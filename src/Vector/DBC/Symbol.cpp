@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/Symbol.h>
+
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+namespace Vector {
+namespace DBC {
+
+/** number of independently locked parts of the symbol table */
+static const std::size_t symbolTableShardCount = 16;
+
+/** part of the symbol table */
+struct SymbolTableShard {
+    /** mutex */
+    std::mutex mutex;
+
+    /** interned strings (nodes, and so strings, don't move) */
+    std::unordered_set<std::string> strings;
+};
+
+/**
+ * @brief Get part of the symbol table
+ * @param[in] string String
+ * @return Part, which holds the string
+ */
+static SymbolTableShard & symbolTableShard(const std::string & string) {
+    /* never destroyed, so symbols stay valid during static destruction */
+    static SymbolTableShard * shards = new SymbolTableShard[symbolTableShardCount];
+
+    return shards[std::hash<std::string>()(string) % symbolTableShardCount];
+}
+
+/**
+ * @brief Intern string
+ * @param[in] string String
+ * @return Interned string
+ */
+static const std::string * intern(std::string && string) {
+    SymbolTableShard & shard = symbolTableShard(string);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return &*shard.strings.insert(std::move(string)).first;
+}
+
+Symbol::Symbol() {
+    static const std::string * emptyString = intern(std::string());
+    string = emptyString;
+}
+
+Symbol::Symbol(const std::string & value) :
+    string(intern(std::string(value))) {
+}
+
+Symbol::Symbol(const char * value) :
+    string(intern(std::string(value))) {
+}
+
+Symbol::Symbol(const char * data, std::size_t size) :
+    string(intern(std::string(data, size))) {
+}
+
+bool Symbol::find(const std::string & value, Symbol & symbol) {
+    SymbolTableShard & shard = symbolTableShard(value);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.strings.find(value);
+    if (it == shard.strings.end())
+        return false;
+    symbol.string = &*it;
+    return true;
+}
+
+}
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <Vector/DBC/StringView.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * Symbol
+ *
+ * Interned string for names, which repeat many times within a network,
+ * like node names in receivers and attribute names. Equal symbols share
+ * one immutable string in a process wide symbol table, so a symbol is
+ * the size of a pointer and equality is a pointer comparison.
+ *
+ * Symbols convert implicitly from and to std::string, so they can be
+ * used like strings. Ordering is the ordering of the strings, so maps
+ * and sets of symbols iterate in the same order as with std::string.
+ * std::less<Symbol> is transparent, so find and count on maps and sets
+ * of symbols compare strings directly, without interning them.
+ *
+ * The symbol table is thread-safe. Interned strings are never released,
+ * so only names, which are stored in a network, should become symbols.
+ */
+class VECTOR_DBC_EXPORT Symbol {
+  public:
+    /** Create empty symbol */
+    Symbol();
+
+    /**
+     * @brief Intern string
+     * @param[in] value String
+     */
+    Symbol(const std::string & value);
+
+    /**
+     * @brief Intern null terminated string
+     * @param[in] value String
+     */
+    Symbol(const char * value);
+
+    /**
+     * @brief Intern string
+     * @param[in] data Data
+     * @param[in] size Size
+     */
+    Symbol(const char * data, std::size_t size);
+
+    /**
+     * @brief Find interned string without interning it
+     * @param[in] value String
+     * @param[out] symbol Symbol (unchanged if the string isn't interned)
+     * @return true if the string is interned
+     */
+    static bool find(const std::string & value, Symbol & symbol);
+
+    /**
+     * @brief Get interned string
+     * @return String
+     */
+    const std::string & str() const noexcept {
+        return *string;
+    }
+
+    /**
+     * @brief Get interned string
+     * @return String
+     */
+    operator const std::string &() const noexcept {
+        return *string;
+    }
+
+    /**
+     * @brief Get view on interned string
+     * @return String View
+     */
+    operator StringView() const noexcept {
+        return StringView(*string);
+    }
+
+    /**
+     * @brief Get null terminated string
+     * @return String
+     */
+    const char * c_str() const noexcept {
+        return string->c_str();
+    }
+
+    /**
+     * @brief Get size
+     * @return Size
+     */
+    std::size_t size() const noexcept {
+        return string->size();
+    }
+
+    /**
+     * @brief Check if symbol is empty
+     * @return true if string is empty
+     */
+    bool empty() const noexcept {
+        return string->empty();
+    }
+
+  private:
+    /** interned string */
+    const std::string * string;
+};
+
+inline bool operator==(const Symbol & lhs, const Symbol & rhs) noexcept {
+    return &lhs.str() == &rhs.str();
+}
+
+inline bool operator==(const Symbol & lhs, const std::string & rhs) noexcept {
+    return lhs.str() == rhs;
+}
+
+inline bool operator==(const std::string & lhs, const Symbol & rhs) noexcept {
+    return lhs == rhs.str();
+}
+
+inline bool operator==(const Symbol & lhs, const char * rhs) noexcept {
+    return lhs.str() == rhs;
+}
+
+inline bool operator==(const char * lhs, const Symbol & rhs) noexcept {
+    return lhs == rhs.str();
+}
+
+template<typename T>
+inline bool operator!=(const Symbol & lhs, const T & rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator!=(const std::string & lhs, const Symbol & rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator!=(const char * lhs, const Symbol & rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+inline bool operator<(const Symbol & lhs, const Symbol & rhs) noexcept {
+    return (lhs != rhs) && (lhs.str() < rhs.str());
+}
+
+inline bool operator<(const Symbol & lhs, const std::string & rhs) noexcept {
+    return lhs.str() < rhs;
+}
+
+inline bool operator<(const std::string & lhs, const Symbol & rhs) noexcept {
+    return lhs < rhs.str();
+}
+
+inline bool operator<(const Symbol & lhs, const char * rhs) noexcept {
+    return lhs.str().compare(rhs) < 0;
+}
+
+inline bool operator<(const char * lhs, const Symbol & rhs) noexcept {
+    return rhs.str().compare(lhs) > 0;
+}
+
+inline std::ostream & operator<<(std::ostream & os, const Symbol & symbol) {
+    return os << symbol.str();
+}
+
+}
+}
+
+namespace std {
+
+/**
+ * Ordering of symbols, which also compares symbols with strings, so
+ * lookups in maps and sets of symbols don't intern the searched string
+ */
+template<>
+struct less<Vector::DBC::Symbol> {
+    /** Compare with strings */
+    using is_transparent = void;
+
+    template<typename T, typename U>
+    bool operator()(const T & lhs, const U & rhs) const noexcept {
+        return lhs < rhs;
+    }
+};
+
+/** Hash of symbol, which is the hash of the interned string's address */
+template<>
+struct hash<Vector::DBC::Symbol> {
+    std::size_t operator()(const Vector::DBC::Symbol & symbol) const noexcept {
+        return std::hash<const std::string *>()(&symbol.str());
+    }
+};
+
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#include <Vector/DBC/ValueDescriptionTable.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace DBC {
+
+/** maximum number of unused entries, that still allow a dense table */
+static const uint64_t maximumDenseGap = 16;
+
+uint32_t StringPool::add(const std::string & string) {
+    auto it = offsets.find(string);
+    if (it != offsets.end())
+        return it->second;
+
+    const uint32_t offset = static_cast<uint32_t>(characters.size());
+    characters.append(string);
+    offsets.emplace(string, offset);
+    return offset;
+}
+
+ValueDescriptionTable::ValueDescriptionTable(const ValueDescriptions & valueDescriptions) :
+    ValueDescriptionTable(valueDescriptions, std::make_shared<StringPool>()) {
+}
+
+ValueDescriptionTable::ValueDescriptionTable(const ValueDescriptions & valueDescriptions, std::shared_ptr<StringPool> stringPool) :
+    pool(stringPool),
+    labelCount(valueDescriptions.size()) {
+    if (valueDescriptions.empty())
+        return;
+
+    /* dense if at most twice as many entries as values, plus a small gap */
+    const uint32_t minimum = valueDescriptions.begin()->first;
+    const uint32_t maximum = valueDescriptions.rbegin()->first;
+    const uint64_t range = static_cast<uint64_t>(maximum) - minimum + 1;
+    if (range <= 2 * valueDescriptions.size() + maximumDenseGap) {
+        minimumValue = minimum;
+        denseLabels.resize(static_cast<std::size_t>(range), Label { 0, 0 });
+        for (const auto & valueDescription : valueDescriptions)
+            denseLabels[valueDescription.first - minimum] = Label { stringPool->add(valueDescription.second), static_cast<uint32_t>(valueDescription.second.size()) };
+        return;
+    }
+
+    /* ValueDescriptions is sorted by value */
+    sparseLabels.reserve(valueDescriptions.size());
+    for (const auto & valueDescription : valueDescriptions)
+        sparseLabels.push_back(Entry { valueDescription.first, Label { stringPool->add(valueDescription.second), static_cast<uint32_t>(valueDescription.second.size()) } });
+}
+
+StringView ValueDescriptionTable::find(uint64_t rawValue) const {
+    /* values beyond 32 bit can't have a description, except sign extended negative values */
+    const int64_t signedValue = static_cast<int64_t>(rawValue);
+    if ((rawValue > UINT32_MAX) && ((signedValue < INT32_MIN) || (signedValue >= 0)))
+        return StringView();
+    const uint32_t value = static_cast<uint32_t>(rawValue);
+
+    /* dense table */
+    if (!denseLabels.empty()) {
+        const uint32_t index = value - minimumValue;
+        if (index >= denseLabels.size())
+            return StringView();
+        const Label & label = denseLabels[index];
+        return pool->view(label.offset, label.size);
+    }
+
+    /* sparse table */
+    auto it = std::lower_bound(sparseLabels.begin(), sparseLabels.end(), value, [](const Entry & lhs, uint32_t rhs) {
+        return lhs.value < rhs;
+    });
+    if ((it == sparseLabels.end()) || (it->value != value))
+        return StringView();
+    return pool->view(it->label.offset, it->label.size);
+}
+
+}
+}
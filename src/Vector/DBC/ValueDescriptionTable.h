@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2013-2019 Tobias Lorenz.
+ * Contact: tobias.lorenz@gmx.net
+ *
+ * This file is part of Tobias Lorenz's Toolkit.
+ *
+ * Commercial License Usage
+ * Licensees holding valid commercial licenses may use this file in
+ * accordance with the commercial license agreement provided with the
+ * Software or, alternatively, in accordance with the terms contained in
+ * a written agreement between you and Tobias Lorenz.
+ *
+ * GNU General Public License 3.0 Usage
+ * Alternatively, this file may be used under the terms of the GNU
+ * General Public License version 3.0 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.GPL included in the
+ * packaging of this file.  Please review the following information to
+ * ensure the GNU General Public License version 3.0 requirements will be
+ * met: http://www.gnu.org/copyleft/gpl.html.
+ */
+
+#pragma once
+
+#include <Vector/DBC/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Vector/DBC/StringView.h>
+#include <Vector/DBC/ValueDescriptions.h>
+
+#include <Vector/DBC/vector_dbc_export.h>
+
+namespace Vector {
+namespace DBC {
+
+/**
+ * String Pool
+ *
+ * All strings stored one after another in a single buffer. Equal
+ * strings are stored once. Strings are referred to by offset and size,
+ * so the buffer may grow while the pool is filled.
+ */
+class VECTOR_DBC_EXPORT StringPool {
+  public:
+    /**
+     * @brief Add string
+     * @param[in] string String
+     * @return Offset of string in pool
+     */
+    uint32_t add(const std::string & string);
+
+    /**
+     * @brief Get string
+     * @param[in] offset Offset as returned by add
+     * @param[in] size Size of string
+     * @return String (valid until the next string is added)
+     */
+    StringView view(uint32_t offset, uint32_t size) const {
+        return StringView(characters.data() + offset, size);
+    }
+
+    /**
+     * @brief Get size of pool
+     * @return Size of all strings in bytes
+     */
+    std::size_t size() const {
+        return characters.size();
+    }
+
+  private:
+    /** characters of all strings */
+    std::string characters {};
+
+    /** offsets of added strings */
+    std::unordered_map<std::string, uint32_t> offsets {};
+};
+
+/**
+ * Value Description Table
+ *
+ * Compiled value descriptions (VAL_) of a signal, to convert raw values
+ * to labels without walking a tree or copying strings. If the values
+ * are compact, the table is a dense array indexed by value, otherwise
+ * a vector sorted by value for binary search.
+ *
+ * Labels are views into a string pool, which may be shared by the
+ * tables of many signals. The pool must not be extended while labels
+ * are used.
+ */
+class VECTOR_DBC_EXPORT ValueDescriptionTable {
+  public:
+    ValueDescriptionTable() = default;
+
+    /**
+     * @brief Compile value descriptions into own string pool
+     * @param[in] valueDescriptions Value Descriptions
+     */
+    explicit ValueDescriptionTable(const ValueDescriptions & valueDescriptions);
+
+    /**
+     * @brief Compile value descriptions into shared string pool
+     * @param[in] valueDescriptions Value Descriptions
+     * @param[in] stringPool String Pool
+     */
+    ValueDescriptionTable(const ValueDescriptions & valueDescriptions, std::shared_ptr<StringPool> stringPool);
+
+    /**
+     * @brief Find label of raw value
+     * @param[in] rawValue Raw value as decoded, sign extended for signed signals
+     * @return Label (empty if there is no value description)
+     *
+     * Negative values of signed signals are looked up as their 32-bit
+     * two's complement.
+     */
+    StringView find(uint64_t rawValue) const;
+
+    /**
+     * @brief Check if table is empty
+     * @return true if there are no value descriptions
+     */
+    bool empty() const {
+        return labelCount == 0;
+    }
+
+    /**
+     * @brief Get number of value descriptions
+     * @return Number of value descriptions
+     */
+    std::size_t size() const {
+        return labelCount;
+    }
+
+    /**
+     * @brief Check if table is a dense array
+     * @return true if labels are looked up by index
+     */
+    bool isDense() const {
+        return !denseLabels.empty();
+    }
+
+  private:
+    /** Label in string pool */
+    struct Label {
+        /** Offset */
+        uint32_t offset;
+
+        /** Size (0 for values without description) */
+        uint32_t size;
+    };
+
+    /** Entry of sparse table */
+    struct Entry {
+        /** Value */
+        uint32_t value;
+
+        /** Label */
+        Label label;
+    };
+
+    /** string pool */
+    std::shared_ptr<const StringPool> pool {};
+
+    /** smallest value (dense table only) */
+    uint32_t minimumValue {};
+
+    /** labels indexed by value - minimumValue (dense table) */
+    std::vector<Label> denseLabels {};
+
+    /** labels sorted by value (sparse table) */
+    std::vector<Entry> sparseLabels {};
+
+    /** number of value descriptions */
+    std::size_t labelCount {};
+};
+
+}
+}
@@ -27,6 +27,8 @@
 #include <map>
 #include <string>
 
+#include <Vector/DBC/Arena.h>
+
 #include <Vector/DBC/vector_dbc_export.h>
 
 namespace Vector {
@@ -35,7 +37,7 @@ namespace DBC {
 /**
  * Value Descriptions
  */
-using ValueDescriptions = std::map<uint32_t, std::string>;
+using ValueDescriptions = ArenaMap<uint32_t, std::string>;
 
 }
 }
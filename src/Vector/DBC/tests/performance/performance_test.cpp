@@ -21,7 +21,9 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "Vector/DBC.h"
@@ -34,11 +36,16 @@ const int measurements = 10000;
  *
  * The columns are:
  * - Number of messages in database (random in range 1..1000)
- * - Measured lookup time (nanoseconds)
+ * - Measured lookup time in Network::messages (nanoseconds)
+ * - Measured lookup time in MessageIndex (nanoseconds)
+ * - Measured lookup time in MessageIndex with standard table (nanoseconds)
  */
 void performance_test_1() {
     Vector::DBC::Network network;
 
+    /* number of lookups that found the message, printed so that they aren't optimized away */
+    unsigned int foundMessages = 0;
+
     /* multiple measurement loops */
     for (auto i = 0; i < measurements; ++i) {
         unsigned int messageCount = (rand() % 1000) + 1;
@@ -60,10 +67,29 @@ void performance_test_1() {
         auto t2 = std::chrono::high_resolution_clock::now();
         assert(message.name == "message_" + std::to_string(id));
 
+        /* and look it up in the index */
+        Vector::DBC::MessageIndex messageIndex(network);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        const Vector::DBC::Message * indexedMessage = messageIndex.find(id);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(indexedMessage == &message);
+        foundMessages += (indexedMessage == &message);
+
+        /* and look it up in the standard table */
+        Vector::DBC::MessageIndex standardIndex(network, true);
+        auto t5 = std::chrono::high_resolution_clock::now();
+        const Vector::DBC::Message * standardMessage = standardIndex.find(id);
+        auto t6 = std::chrono::high_resolution_clock::now();
+        assert(standardMessage == &message);
+        foundMessages += (standardMessage == &message);
+
         /* print result */
         std::chrono::nanoseconds ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1);
-        std::cout << messageCount << "\t" << ns.count() << std::endl;
+        std::chrono::nanoseconds indexNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t4 - t3);
+        std::chrono::nanoseconds standardNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t6 - t5);
+        std::cout << messageCount << "\t" << ns.count() << "\t" << indexNs.count() << "\t" << standardNs.count() << std::endl;
     }
+    std::cout << "# found " << foundMessages << " of " << 2 * measurements << " messages" << std::endl;
 }
 
 /**
@@ -92,7 +118,7 @@ void performance_test_2() {
         /* and look it up */
         auto t1 = std::chrono::high_resolution_clock::now();
         for (const auto & signal : message.signals)
-            std::string & signalName = signal.second.name;
+            const std::string & signalName = signal.second.name;
         auto t2 = std::chrono::high_resolution_clock::now();
 
         /* print result */
@@ -136,6 +162,289 @@ void performance_test_3(Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType
     }
 }
 
+/**
+ * This measures the time to encode a signal.
+ *
+ * The generated columns are:
+ * - Bit size of signal (random in range 1..64)
+ * - Measured encode time (nanoseconds)
+ */
+void performance_test_4(Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType valueType) {
+    /* multiple measurement loops */
+    for (auto i = 0; i < measurements; ++i) {
+        unsigned int bitSize = (rand() % 64) + 1;
+
+        /* setup 8 byte random data */
+        std::vector<uint8_t> data;
+        for (auto b = 0; b < 8; ++b)
+            data.push_back(rand() % 0x100);
+
+        /* setup signal */
+        Vector::DBC::Signal signal;
+        signal.byteOrder = byteOrder;
+        signal.startBit = (byteOrder == Vector::DBC::ByteOrder::BigEndian) ? 7 : 0;
+        signal.bitSize = bitSize;
+        signal.valueType = valueType;
+
+        /* setup random raw value */
+        std::uint64_t value = (static_cast<std::uint64_t>(rand()) << 32) | rand();
+
+        /* and encode it */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        signal.encode(data, value);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::nanoseconds ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1);
+        std::cout << bitSize << "\t" << ns.count() << std::endl;
+    }
+}
+
+/**
+ * This measures the time to decode a signal from many payloads.
+ *
+ * The generated columns are:
+ * - Bit size of signal (random in range 1..64)
+ * - Measured decode time per payload with CompiledSignal (nanoseconds)
+ * - Measured decode time per payload with ColumnDecoder (nanoseconds)
+ */
+void performance_test_5(Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType valueType) {
+    /** number of payloads */
+    const std::size_t payloadCount = 4096;
+
+    /* setup 8 byte random payloads */
+    std::vector<uint8_t> data;
+    for (std::size_t b = 0; b < 8 * payloadCount; ++b)
+        data.push_back(rand() % 0x100);
+    std::vector<double> values(payloadCount);
+
+    /* multiple measurement loops */
+    for (auto i = 0; i < measurements / 10; ++i) {
+        unsigned int bitSize = (rand() % 64) + 1;
+
+        /* setup signal */
+        Vector::DBC::Signal signal;
+        signal.byteOrder = byteOrder;
+        signal.startBit = (byteOrder == Vector::DBC::ByteOrder::BigEndian) ? 7 : 0;
+        signal.bitSize = bitSize;
+        signal.valueType = valueType;
+        signal.factor = 0.5;
+        signal.offset = 1.0;
+        Vector::DBC::CompiledSignal compiledSignal(signal);
+
+        /* and decode it payload by payload */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (std::size_t k = 0; k < payloadCount; ++k)
+            values[k] = compiledSignal.decodePhysicalValue(&data[8 * k]);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* and decode it with the column decoder */
+        auto t3 = std::chrono::high_resolution_clock::now();
+        Vector::DBC::ColumnDecoder::decode(compiledSignal, data.data(), 8, payloadCount, values.data());
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::nanoseconds ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1);
+        std::chrono::nanoseconds columnNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t4 - t3);
+        std::cout << bitSize << "\t" << static_cast<double>(ns.count()) / payloadCount << "\t" << static_cast<double>(columnNs.count()) / payloadCount << std::endl;
+    }
+}
+
+/**
+ * This measures the time to parse a large database.
+ *
+ * The generated columns are:
+ * - Number of messages in database (random in range 1..2000, each with 16 signals)
+ * - Measured parse time from stream (milliseconds)
+ * - Measured parse time with loadBuffer (milliseconds)
+ * - Measured parse time with loadBuffer on all hardware threads (milliseconds)
+ * - Measured parse time with loadBuffer into an arena, including release (milliseconds)
+ */
+void performance_test_6() {
+    /* multiple measurement loops */
+    for (auto i = 0; i < measurements / 100; ++i) {
+        unsigned int messageCount = (rand() % 2000) + 1;
+
+        /* generate the database */
+        std::ostringstream oss;
+        oss << "VERSION \"\"" << std::endl
+            << std::endl
+            << "NS_ :" << std::endl
+            << std::endl
+            << "BS_:" << std::endl
+            << std::endl
+            << "BU_: Node_1 Node_2" << std::endl
+            << std::endl;
+        for (unsigned int id = 0; id < messageCount; ++id) {
+            oss << "BO_ " << id << " Message_" << id << ": 64 Node_1" << std::endl;
+            for (unsigned int nr = 0; nr < 16; ++nr)
+                oss << " SG_ Signal_" << id << "_" << nr << " : " << (32 * nr) << "|32@1+ (0.5,1) [0|0] \"unit\" Node_1,Node_2" << std::endl;
+            oss << std::endl;
+        }
+        for (unsigned int id = 0; id < messageCount; ++id)
+            oss << "VAL_ " << id << " Signal_" << id << "_0 0 \"Off\" 1 \"On\" 2 \"Error\" 3 \"Init\" ;" << std::endl;
+        std::string text = oss.str();
+
+        /* and parse it */
+        std::istringstream iss(text);
+        Vector::DBC::Network network;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        iss >> network;
+        auto t2 = std::chrono::high_resolution_clock::now();
+        assert(network.successfullyParsed);
+        assert(network.messages.size() == messageCount);
+
+        /* and parse it in place */
+        Vector::DBC::Network bufferNetwork;
+        auto t3 = std::chrono::high_resolution_clock::now();
+        Vector::DBC::loadBuffer(bufferNetwork, text.data(), text.size());
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(bufferNetwork.messages.size() == messageCount);
+
+        /* and parse it in parallel */
+        Vector::DBC::Network parallelNetwork;
+        auto t5 = std::chrono::high_resolution_clock::now();
+        Vector::DBC::loadBuffer(parallelNetwork, text.data(), text.size(), 0);
+        auto t6 = std::chrono::high_resolution_clock::now();
+        assert(parallelNetwork.messages.size() == messageCount);
+
+        /* and parse it into an arena */
+        Vector::DBC::Arena arena;
+        auto t7 = std::chrono::high_resolution_clock::now();
+        {
+            Vector::DBC::ArenaScope scope(arena);
+            Vector::DBC::Network arenaNetwork;
+            Vector::DBC::loadBuffer(arenaNetwork, text.data(), text.size());
+            assert(arenaNetwork.messages.size() == messageCount);
+        }
+        auto t8 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1);
+        std::chrono::milliseconds bufferMs = std::chrono::duration_cast<std::chrono::milliseconds>(t4 - t3);
+        std::chrono::milliseconds parallelMs = std::chrono::duration_cast<std::chrono::milliseconds>(t6 - t5);
+        std::chrono::milliseconds arenaMs = std::chrono::duration_cast<std::chrono::milliseconds>(t8 - t7);
+        std::cout << messageCount << "\t" << ms.count() << "\t" << bufferMs.count() << "\t" << parallelMs.count() << "\t" << arenaMs.count() << std::endl;
+    }
+}
+
+/**
+ * This measures the time to iterate over all signals of all messages.
+ *
+ * The generated columns are:
+ * - Number of messages in database (random in range 1..2000, each with 16 signals)
+ * - Measured iteration time per signal over Network::messages (nanoseconds)
+ * - Measured iteration time per signal over FlatNetwork (nanoseconds)
+ * - Measured iteration time per signal over FlatNetwork compiled signals (nanoseconds)
+ */
+void performance_test_7() {
+    /* multiple measurement loops */
+    for (auto i = 0; i < measurements / 100; ++i) {
+        unsigned int messageCount = (rand() % 2000) + 1;
+
+        /* setup the network, with messages and signals created in random order like in a parsed database */
+        Vector::DBC::Network network;
+        for (unsigned int n = 0; n < 16 * messageCount; ++n) {
+            unsigned int id = rand() % messageCount;
+            unsigned int nr = rand() % 16;
+            Vector::DBC::Message & message = network.messages[id];
+            message.id = id;
+            std::string signalName = "signal_" + std::to_string(nr);
+            Vector::DBC::Signal & signal = message.signals[signalName];
+            signal.name = signalName;
+            signal.startBit = 4 * nr;
+            signal.bitSize = 4;
+        }
+        Vector::DBC::FlatNetwork flatNetwork(network);
+        std::size_t signalCount = flatNetwork.signals().size();
+
+        /* and iterate over the maps */
+        volatile uint32_t sum = 0;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (const auto & message : network.messages)
+            for (const auto & signal : message.second.signals)
+                sum = sum + signal.second.startBit;
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* and iterate over the flat network */
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (const Vector::DBC::FlatMessage & message : flatNetwork.messages())
+            for (const Vector::DBC::Signal & signal : flatNetwork.signals(message))
+                sum = sum + signal.startBit;
+        auto t4 = std::chrono::high_resolution_clock::now();
+
+        /* and iterate over the compiled signals */
+        auto t5 = std::chrono::high_resolution_clock::now();
+        for (const Vector::DBC::FlatMessage & message : flatNetwork.messages())
+            for (const Vector::DBC::CompiledSignal & compiledSignal : flatNetwork.compiledSignals(message))
+                sum = sum + compiledSignal.shift;
+        auto t6 = std::chrono::high_resolution_clock::now();
+
+        /* print result */
+        std::chrono::nanoseconds ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1);
+        std::chrono::nanoseconds flatNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t4 - t3);
+        std::chrono::nanoseconds compiledNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t6 - t5);
+        std::cout << messageCount << "\t" << static_cast<double>(ns.count()) / signalCount << "\t" << static_cast<double>(flatNs.count()) / signalCount << "\t" << static_cast<double>(compiledNs.count()) / signalCount << std::endl;
+    }
+}
+
+/**
+ * This measures the time to write a large database.
+ *
+ * The generated columns are:
+ * - Number of messages in database (random in range 1..2000, each with 16 signals)
+ * - Measured write time with operator<<, which writes via a stream sink (milliseconds)
+ * - Measured write time with NetworkWriter into its buffer (milliseconds)
+ */
+void performance_test_8() {
+    /* multiple measurement loops */
+    for (auto i = 0; i < measurements / 100; ++i) {
+        unsigned int messageCount = (rand() % 2000) + 1;
+
+        /* generate the database */
+        std::ostringstream oss;
+        oss << "VERSION \"\"" << std::endl
+            << std::endl
+            << "NS_ :" << std::endl
+            << std::endl
+            << "BS_:" << std::endl
+            << std::endl
+            << "BU_: Node_1 Node_2" << std::endl
+            << std::endl;
+        for (unsigned int id = 0; id < messageCount; ++id) {
+            oss << "BO_ " << id << " Message_" << id << ": 64 Node_1" << std::endl;
+            for (unsigned int nr = 0; nr < 16; ++nr)
+                oss << " SG_ Signal_" << id << "_" << nr << " : " << (32 * nr) << "|32@1+ (0.1,-40) [-40|6553.5] \"unit\" Node_1,Node_2" << std::endl;
+            oss << std::endl;
+        }
+        oss << "BA_DEF_ SG_ \"GenSigStartValue\" INT 0 2147483647;" << std::endl;
+        for (unsigned int id = 0; id < messageCount; ++id)
+            oss << "BA_ \"GenSigStartValue\" SG_ " << id << " Signal_" << id << "_0 " << id << ";" << std::endl;
+        std::string text = oss.str();
+        Vector::DBC::Network network;
+        Vector::DBC::loadBuffer(network, text.data(), text.size());
+        assert(network.messages.size() == messageCount);
+
+        /* and write it to a stream */
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::ostringstream output;
+        output << network;
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        /* and write it with the network writer */
+        auto t3 = std::chrono::high_resolution_clock::now();
+        Vector::DBC::NetworkWriter writer;
+        writer.write(network);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(writer.buffer() == output.str());
+
+        /* print result */
+        std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1);
+        std::chrono::milliseconds writerMs = std::chrono::duration_cast<std::chrono::milliseconds>(t4 - t3);
+        std::cout << messageCount << "\t" << ms.count() << "\t" << writerMs.count() << std::endl;
+    }
+}
+
 int main(int argc, char ** argv) {
     /* safety check */
     if (argc != 2) {
@@ -158,6 +467,28 @@ int main(int argc, char ** argv) {
         performance_test_3(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed);
     else if (id == "3bu")
         performance_test_3(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "4ls")
+        performance_test_4(Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed);
+    else if (id == "4lu")
+        performance_test_4(Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "4bs")
+        performance_test_4(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed);
+    else if (id == "4bu")
+        performance_test_4(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "5ls")
+        performance_test_5(Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed);
+    else if (id == "5lu")
+        performance_test_5(Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "5bs")
+        performance_test_5(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed);
+    else if (id == "5bu")
+        performance_test_5(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned);
+    else if (id == "6")
+        performance_test_6();
+    else if (id == "7")
+        performance_test_7();
+    else if (id == "8")
+        performance_test_8();
 
     return 0;
 }
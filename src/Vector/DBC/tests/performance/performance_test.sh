@@ -14,7 +14,9 @@ set ylabel "lookup time (ns)"
 set yrange [0:1000]
 set terminal pdf
 set output "table_${ID}.pdf"
-plot 'table_${ID}.csv' using 1:2
+plot 'table_${ID}.csv' using 1:2 title "Network::messages", \
+     'table_${ID}.csv' using 1:3 title "MessageIndex", \
+     'table_${ID}.csv' using 1:4 title "MessageIndex (standard table)"
 END
 
 ID="2"
@@ -82,6 +84,156 @@ set output "table_${ID}.pdf"
 plot 'table_${ID}.csv' using 1:2
 END
 
+ID="4lu"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to encode a signal (little endian, unsigned)"
+set xlabel "bit size of signal"
+set ylabel "encode time (ns)"
+set yrange [0:1000]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2
+END
+
+ID="4ls"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to encode a signal (little endian, signed)"
+set xlabel "bit size of signal"
+set ylabel "encode time (ns)"
+set yrange [0:1000]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2
+END
+
+ID="4bu"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to encode a signal (big endian, unsigned)"
+set xlabel "bit size of signal"
+set ylabel "encode time (ns)"
+set yrange [0:1000]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2
+END
+
+ID="4bs"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to encode a signal (big endian, signed)"
+set xlabel "bit size of signal"
+set ylabel "encode time (ns)"
+set yrange [0:1000]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2
+END
+
+ID="5lu"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode a signal per payload (little endian, unsigned)"
+set xlabel "bit size of signal"
+set ylabel "decode time (ns)"
+set yrange [0:10]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "CompiledSignal", \
+     'table_${ID}.csv' using 1:3 title "ColumnDecoder"
+END
+
+ID="5ls"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode a signal per payload (little endian, signed)"
+set xlabel "bit size of signal"
+set ylabel "decode time (ns)"
+set yrange [0:10]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "CompiledSignal", \
+     'table_${ID}.csv' using 1:3 title "ColumnDecoder"
+END
+
+ID="5bu"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode a signal per payload (big endian, unsigned)"
+set xlabel "bit size of signal"
+set ylabel "decode time (ns)"
+set yrange [0:10]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "CompiledSignal", \
+     'table_${ID}.csv' using 1:3 title "ColumnDecoder"
+END
+
+ID="5bs"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to decode a signal per payload (big endian, signed)"
+set xlabel "bit size of signal"
+set ylabel "decode time (ns)"
+set yrange [0:10]
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "CompiledSignal", \
+     'table_${ID}.csv' using 1:3 title "ColumnDecoder"
+END
+
+ID="6"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to parse a database (16 signals per message)"
+set xlabel "number of messages"
+set ylabel "parse time (ms)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "istream", \
+     'table_${ID}.csv' using 1:3 title "loadBuffer", \
+     'table_${ID}.csv' using 1:4 title "loadBuffer (all hardware threads)", \
+     'table_${ID}.csv' using 1:5 title "loadBuffer (arena, including release)"
+END
+
+ID="7"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to iterate over all signals of all messages (16 signals per message)"
+set xlabel "number of messages"
+set ylabel "iteration time per signal (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "Network::messages", \
+     'table_${ID}.csv' using 1:3 title "FlatNetwork", \
+     'table_${ID}.csv' using 1:4 title "FlatNetwork (compiled signals)"
+END
+
+ID="8"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to write a database (16 signals per message)"
+set xlabel "number of messages"
+set ylabel "write time (ms)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "operator<< (stream sink)", \
+     'table_${ID}.csv' using 1:3 title "NetworkWriter (buffer)"
+END
+
 echo "Generating report"
 pdftk table_*.pdf cat output - > performance_measurement.pdf
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/** snapshot copied into memory aligned to 8 bytes */
+struct AlignedSnapshot {
+    explicit AlignedSnapshot(const std::string & snapshot) :
+        buffer((snapshot.size() + 7) / 8),
+        size(snapshot.size()) {
+        std::memcpy(buffer.data(), snapshot.data(), size);
+    }
+
+    char * data() {
+        return reinterpret_cast<char *>(buffer.data());
+    }
+
+    const char * data() const {
+        return reinterpret_cast<const char *>(buffer.data());
+    }
+
+    std::vector<uint64_t> buffer;
+    std::size_t size;
+};
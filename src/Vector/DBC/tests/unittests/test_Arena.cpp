@@ -0,0 +1,131 @@
+#define BOOST_TEST_MODULE Arena
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <Vector/DBC.h>
+
+BOOST_AUTO_TEST_CASE(Allocation) {
+    Vector::DBC::Arena arena(0x100);
+    BOOST_CHECK_EQUAL(arena.blockSize(), 0);
+
+    /* alignment */
+    void * p1 = arena.allocate(1, 1);
+    void * p2 = arena.allocate(8, 8);
+    void * p3 = arena.allocate(16, 16);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(p2) % 8, 0);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(p3) % 16, 0);
+    BOOST_CHECK(p1 != p2);
+    BOOST_CHECK_EQUAL(arena.blockSize(), 0x100);
+
+    /* allocations larger than a block */
+    void * p4 = arena.allocate(0x1000, 8);
+    BOOST_CHECK(p4 != nullptr);
+    BOOST_CHECK_GE(arena.blockSize(), 0x1100);
+
+    /* scopes nest */
+    BOOST_CHECK(Vector::DBC::Arena::current() == nullptr);
+    {
+        Vector::DBC::ArenaScope scope(arena);
+        BOOST_CHECK(Vector::DBC::Arena::current() == &arena);
+        {
+            Vector::DBC::Arena innerArena;
+            Vector::DBC::ArenaScope innerScope(innerArena);
+            BOOST_CHECK(Vector::DBC::Arena::current() == &innerArena);
+        }
+        BOOST_CHECK(Vector::DBC::Arena::current() == &arena);
+    }
+    BOOST_CHECK(Vector::DBC::Arena::current() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Network) {
+    /* load without arena */
+    Vector::DBC::Network heapNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadFile(heapNetwork, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    BOOST_CHECK(heapNetwork.messages.get_allocator().arena == nullptr);
+    std::ostringstream heapOutput;
+    heapOutput << heapNetwork;
+
+    /* load with arena */
+    Vector::DBC::Arena arena;
+    auto loadArenaNetwork = [&arena]() {
+        Vector::DBC::ArenaScope scope(arena);
+        Vector::DBC::Network network;
+        BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+        return network;
+    };
+
+    /* move construction keeps the arena */
+    Vector::DBC::Network arenaNetwork(loadArenaNetwork());
+    BOOST_CHECK(arenaNetwork.messages.get_allocator().arena == &arena);
+    BOOST_REQUIRE(!arenaNetwork.messages.empty());
+    const Vector::DBC::Message & message = arenaNetwork.messages.begin()->second;
+    BOOST_CHECK(message.signals.get_allocator().arena == &arena);
+    BOOST_CHECK_GT(arena.blockSize(), 0);
+
+    /* same content */
+    std::ostringstream arenaOutput;
+    arenaOutput << arenaNetwork;
+    BOOST_CHECK_EQUAL(arenaOutput.str(), heapOutput.str());
+
+    /* copies outside of the scope allocate from the heap */
+    Vector::DBC::Network copiedNetwork = arenaNetwork;
+    BOOST_CHECK(copiedNetwork.messages.get_allocator().arena == nullptr);
+    BOOST_CHECK(copiedNetwork.messages.begin()->second.signals.get_allocator().arena == nullptr);
+    std::ostringstream copiedOutput;
+    copiedOutput << copiedNetwork;
+    BOOST_CHECK_EQUAL(copiedOutput.str(), heapOutput.str());
+
+    /* move assignment keeps the arena of the target */
+    Vector::DBC::Network movedNetwork;
+    movedNetwork = std::move(arenaNetwork);
+    BOOST_CHECK(movedNetwork.messages.get_allocator().arena == nullptr);
+    BOOST_CHECK(movedNetwork.messages.begin()->second.signals.get_allocator().arena == nullptr);
+    std::ostringstream movedOutput;
+    movedOutput << movedNetwork;
+    BOOST_CHECK_EQUAL(movedOutput.str(), heapOutput.str());
+}
+
+BOOST_AUTO_TEST_CASE(LoadParallel) {
+    /* generate database with a large messages section */
+    std::ostringstream oss;
+    oss << "VERSION \"\"\n\nNS_ :\n\tCM_\n\nBS_:\n\nBU_: Node_1 Node_2\n\n\n";
+    for (unsigned int id = 0; id < 1000; ++id) {
+        oss << "BO_ " << id << " Message_" << id << ": 8 Node_1\n"
+            << " SG_ Signal_0 : 0|8@1+ (1,0) [0|255] \"unit\" Node_2\n"
+            << " SG_ Signal_1 : 8|8@1+ (1,0) [0|255] \"\" Node_1,Node_2\n\n";
+    }
+    oss << "CM_ BO_ 2 \"Message\";\n"
+        << "CM_ SG_ 3 Signal_0 \"Signal\";\n";
+    const std::string text = oss.str();
+
+    /* load without arena */
+    Vector::DBC::Network heapNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadBuffer(heapNetwork, text.data(), text.size()));
+    std::ostringstream heapOutput;
+    heapOutput << heapNetwork;
+
+    /* load in parallel with arena, which replaces the network instead of extending it */
+    Vector::DBC::Arena arena;
+    Vector::DBC::ArenaScope scope(arena);
+    Vector::DBC::Network arenaNetwork;
+    arenaNetwork.nodes["Sequential"];
+    BOOST_REQUIRE(Vector::DBC::loadBuffer(arenaNetwork, text.data(), text.size(), 4));
+    BOOST_CHECK_EQUAL(arenaNetwork.nodes.count("Sequential"), 0);
+
+    /* messages of all threads are in the arena */
+    BOOST_REQUIRE_EQUAL(arenaNetwork.messages.size(), 1000);
+    BOOST_CHECK(arenaNetwork.messages.get_allocator().arena == &arena);
+    for (const auto & message : arenaNetwork.messages)
+        BOOST_CHECK(message.second.signals.get_allocator().arena == &arena);
+
+    /* same content */
+    std::ostringstream arenaOutput;
+    arenaOutput << arenaNetwork;
+    BOOST_CHECK(arenaOutput.str() == heapOutput.str());
+}
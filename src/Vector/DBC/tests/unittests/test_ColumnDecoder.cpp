@@ -0,0 +1,98 @@
+#define BOOST_TEST_MODULE ColumnDecoder
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/**
+ * @brief Physical value as decoded by Signal
+ * @param[in] signal Signal
+ * @param[in] data Payload
+ * @param[in] size Size of payload
+ * @return Physical Value
+ */
+static double signalPhysicalValue(const Vector::DBC::Signal & signal, const uint8_t * data, std::size_t size) {
+    const uint64_t rawValue = signal.decode(data, size);
+    if (signal.valueType == Vector::DBC::ValueType::Signed)
+        return signal.rawToPhysicalValue(static_cast<double>(static_cast<int64_t>(rawValue)));
+    return signal.rawToPhysicalValue(static_cast<double>(rawValue));
+}
+
+/**
+ * @brief Check selected kernel against Signal for all bit sizes, byte orders and value types
+ */
+static void checkKernel() {
+    /* random payloads */
+    const std::size_t count = 37;
+    std::srand(1);
+    for (std::size_t stride : { 8, 64 }) {
+        std::vector<uint8_t> data(count * stride);
+        for (auto & byte : data)
+            byte = static_cast<uint8_t>(std::rand());
+
+        for (auto byteOrder : { Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ByteOrder::BigEndian }) {
+            for (auto valueType : { Vector::DBC::ValueType::Unsigned, Vector::DBC::ValueType::Signed }) {
+                for (uint32_t bitSize = 1; bitSize <= 64; ++bitSize) {
+                    for (uint32_t startBit = 0; startBit < 8 * stride; startBit += 3) {
+                        Vector::DBC::Signal signal;
+                        signal.startBit = startBit;
+                        signal.bitSize = bitSize;
+                        signal.byteOrder = byteOrder;
+                        signal.valueType = valueType;
+                        signal.factor = 0.1;
+                        signal.offset = -7.0;
+                        Vector::DBC::CompiledSignal compiledSignal(signal);
+                        if (compiledSignal.dataSize > stride)
+                            continue;
+
+                        std::vector<double> doubleValues(count);
+                        std::vector<float> floatValues(count);
+                        Vector::DBC::ColumnDecoder::decode(compiledSignal, data.data(), stride, count, doubleValues.data());
+                        Vector::DBC::ColumnDecoder::decode(compiledSignal, data.data(), stride, count, floatValues.data());
+                        for (std::size_t k = 0; k < count; ++k) {
+                            const double value = signalPhysicalValue(signal, &data[k * stride], stride);
+                            if (compiledSignal.decodePhysicalValue(&data[k * stride]) != value)
+                                BOOST_FAIL("compiled signal mismatch at startBit " << startBit << " bitSize " << bitSize);
+                            if (doubleValues[k] != value)
+                                BOOST_FAIL("double mismatch at startBit " << startBit << " bitSize " << bitSize);
+                            if (floatValues[k] != static_cast<float>(value))
+                                BOOST_FAIL("float mismatch at startBit " << startBit << " bitSize " << bitSize);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Check all kernels supported by the CPU against Signal.
+ */
+BOOST_AUTO_TEST_CASE(ColumnDecoderDecode) {
+    BOOST_TEST_MESSAGE("selected kernel: " << Vector::DBC::ColumnDecoder::implementation());
+
+    for (const char * implementation : { "avx2", "sse4.1", "scalar" }) {
+        if (!Vector::DBC::ColumnDecoder::setImplementation(implementation)) {
+            BOOST_TEST_MESSAGE("kernel " << implementation << " not supported");
+            continue;
+        }
+        BOOST_TEST_CONTEXT("kernel " << implementation) {
+            BOOST_CHECK_EQUAL(Vector::DBC::ColumnDecoder::implementation(), implementation);
+            checkKernel();
+        }
+    }
+
+    /* scalar is always supported, unknown kernels never */
+    BOOST_CHECK(Vector::DBC::ColumnDecoder::setImplementation("scalar"));
+    BOOST_CHECK(!Vector::DBC::ColumnDecoder::setImplementation("unknown"));
+    BOOST_CHECK_EQUAL(Vector::DBC::ColumnDecoder::implementation(), "scalar");
+
+    /* back to the best kernel */
+    BOOST_CHECK(Vector::DBC::ColumnDecoder::setImplementation(nullptr));
+}
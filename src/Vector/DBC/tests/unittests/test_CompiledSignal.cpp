@@ -0,0 +1,89 @@
+#define BOOST_TEST_MODULE CompiledSignal
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/**
+ * Check that compiled signals decode/encode the same as Signal
+ * for all start bits, bit sizes, byte orders and value types.
+ */
+BOOST_AUTO_TEST_CASE(CompiledSignalDecodeEncode) {
+    /* 64 bytes like CAN FD */
+    std::vector<uint8_t> background(64);
+    for (uint8_t i = 0; i < 64; ++i)
+        background[i] = 0x3C ^ (i * 0x47);
+    const uint64_t rawValues[] = { 0x0000000000000000, 0xFFFFFFFFFFFFFFFF, 0xFEDCBA9876543210 };
+
+    Vector::DBC::Signal signal;
+    for (auto byteOrder : { Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ByteOrder::LittleEndian }) {
+        signal.byteOrder = byteOrder;
+        for (auto valueType : { Vector::DBC::ValueType::Unsigned, Vector::DBC::ValueType::Signed }) {
+            signal.valueType = valueType;
+            for (signal.startBit = 0; signal.startBit < 512; ++signal.startBit) {
+                for (signal.bitSize = 1; signal.bitSize <= 64; ++signal.bitSize) {
+                    Vector::DBC::CompiledSignal compiledSignal(signal);
+                    if (compiledSignal.dataSize > background.size())
+                        continue;
+
+                    /* decode */
+                    BOOST_CHECK_EQUAL(compiledSignal.decode(background.data()), signal.decode(background));
+
+                    /* encode */
+                    for (auto rawValue : rawValues) {
+                        std::vector<uint8_t> expected = background;
+                        signal.encode(expected, rawValue);
+                        std::vector<uint8_t> data = background;
+                        compiledSignal.encode(data.data(), rawValue);
+                        BOOST_CHECK(data == expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Check data size, physical values and invalid bit sizes.
+ */
+BOOST_AUTO_TEST_CASE(CompiledSignalPhysicalValue) {
+    Vector::DBC::Signal signal;
+    signal.startBit = 0;
+    signal.bitSize = 10;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    signal.factor = 0.25;
+    signal.offset = 1.0;
+
+    /* signed: data = 1000011010b ==> rawValue=0x21A ==> physicalValue = -120.5 */
+    uint8_t data[8] = { 0x1A, 0x02 };
+    Vector::DBC::CompiledSignal compiledSignal(signal);
+    BOOST_CHECK_EQUAL(compiledSignal.dataSize, 8);
+    BOOST_CHECK_EQUAL(compiledSignal.decodePhysicalValue(data), -120.5);
+
+    /* unsigned: data = 1000011010b ==> rawValue=0x21A ==> physicalValue = 135.5 */
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+    compiledSignal = Vector::DBC::CompiledSignal(signal);
+    BOOST_CHECK_EQUAL(compiledSignal.decodePhysicalValue(data), 135.5);
+
+    /* Motorola signal in the last byte of a CAN FD frame */
+    signal.startBit = 511;
+    signal.bitSize = 8;
+    signal.byteOrder = Vector::DBC::ByteOrder::BigEndian;
+    compiledSignal = Vector::DBC::CompiledSignal(signal);
+    BOOST_CHECK_EQUAL(compiledSignal.dataSize, 64);
+
+    /* bit size 0 decodes to 0 and doesn't encode */
+    signal.startBit = 0;
+    signal.bitSize = 0;
+    compiledSignal = Vector::DBC::CompiledSignal(signal);
+    BOOST_CHECK_EQUAL(compiledSignal.decode(data), 0);
+    compiledSignal.encode(data, 0xFFFFFFFFFFFFFFFF);
+    BOOST_CHECK_EQUAL(data[0], 0x1A);
+    BOOST_CHECK_EQUAL(data[1], 0x02);
+}
@@ -5,7 +5,10 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 #include <boost/filesystem.hpp>
 
 #include <Vector/DBC.h>
@@ -40,3 +43,165 @@ BOOST_AUTO_TEST_CASE(File) {
     std::istream_iterator<char> b2(ifs2), e2;
     BOOST_CHECK_EQUAL_COLLECTIONS(b1, e1, b2, e2);
 }
+
+BOOST_AUTO_TEST_CASE(ExtendedMultiplexing) {
+    Vector::DBC::Network network;
+
+    /* load database file */
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/ExtendedMultiplexing.dbc");
+    std::ifstream ifs(infile.string());
+    BOOST_REQUIRE(ifs.is_open());
+    ifs >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+    ifs.close();
+
+    /* check value ranges */
+    const Vector::DBC::Message & message = network.messages[100];
+    const Vector::DBC::ExtendedMultiplexor & extendedMultiplexor = message.signals.at("Signal_3").extendedMultiplexors.at("Switch_2");
+    BOOST_CHECK_EQUAL(extendedMultiplexor.switchName, "Switch_2");
+    BOOST_REQUIRE_EQUAL(extendedMultiplexor.valueRanges.size(), 2);
+    BOOST_CHECK(extendedMultiplexor.valueRanges.count(std::make_pair(3, 3)) == 1);
+    BOOST_CHECK(extendedMultiplexor.valueRanges.count(std::make_pair(100, 200)) == 1);
+    BOOST_CHECK_EQUAL(message.signals.at("Signal_1").extendedMultiplexors.at("Switch_1").valueRanges.size(), 2);
+
+    /* at least one value range, separated by commas */
+    const std::vector<std::pair<std::string, bool>> valueRanges {
+        { " 1-2, 4-4;", true },
+        { " 1-2;", true },
+        { ", 1-2;", false },
+        { " 1-2,;", false },
+        { " 1-2,, 4-4;", false },
+        { ";", false } };
+    for (const auto & valueRange : valueRanges) {
+        std::istringstream iss(
+            "VERSION \"\"\n\nNS_ :\n\nBS_:\n\nBU_:\n\n"
+            "BO_ 1 Message_1: 8 Vector__XXX\n"
+            " SG_ Switch M : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+            " SG_ Signal m1 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n\n"
+            "SG_MUL_VAL_ 1 Signal Switch" + valueRange.first + "\n");
+        Vector::DBC::Network rangeNetwork;
+        std::streambuf * cerrBuffer = std::cerr.rdbuf(nullptr);
+        iss >> rangeNetwork;
+        std::cerr.rdbuf(cerrBuffer);
+        BOOST_CHECK_MESSAGE(rangeNetwork.successfullyParsed == valueRange.second, "SG_MUL_VAL_ ..." << valueRange.first);
+    }
+
+    /* decode along the switch chain: Switch_1, Signal_4, Switch_2, Signal_2, Signal_3 */
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    Vector::DBC::SignalValue values[6];
+    uint32_t indices[6];
+    std::vector<uint8_t> data { 0x00, 0x03, 0x11, 0x00, 0x00, 0x00, 0x00, 0x44 };
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(100, data.data(), data.size(), values, indices), 5);
+    data[0] = 7;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(100, data.data(), data.size(), values, indices), 3);
+}
+
+BOOST_AUTO_TEST_CASE(LoadFile) {
+    /* load database file via stream */
+    Vector::DBC::Network streamNetwork;
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc");
+    std::ifstream ifs(infile.string());
+    BOOST_REQUIRE(ifs.is_open());
+    ifs >> streamNetwork;
+    BOOST_REQUIRE(streamNetwork.successfullyParsed);
+    ifs.close();
+    std::ostringstream streamOutput;
+    streamOutput << streamNetwork;
+
+    /* load mapped database file */
+    Vector::DBC::Network fileNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadFile(fileNetwork, infile.string()));
+    BOOST_CHECK(fileNetwork.successfullyParsed);
+    std::ostringstream fileOutput;
+    fileOutput << fileNetwork;
+    BOOST_CHECK(fileOutput.str() == streamOutput.str());
+
+    /* load database from memory */
+    Vector::DBC::MappedFile mappedFile(infile.string());
+    BOOST_REQUIRE(mappedFile.isOpen());
+    std::vector<char> buffer(mappedFile.data(), mappedFile.data() + mappedFile.size());
+    Vector::DBC::Network bufferNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadBuffer(bufferNetwork, buffer.data(), buffer.size()));
+    std::ostringstream bufferOutput;
+    bufferOutput << bufferNetwork;
+    BOOST_CHECK(bufferOutput.str() == streamOutput.str());
+
+    /* missing file */
+    Vector::DBC::Network missingNetwork;
+    BOOST_CHECK(!Vector::DBC::loadFile(missingNetwork, CMAKE_CURRENT_SOURCE_DIR "/data/Missing.dbc"));
+    BOOST_CHECK(!missingNetwork.successfullyParsed);
+}
+
+BOOST_AUTO_TEST_CASE(LoadParallel) {
+    /* generate database with a large messages section */
+    std::ostringstream oss;
+    oss << "VERSION \"\"\n\nNS_ :\n\tCM_\n\tBA_\n\nBS_:\n\nBU_: Node_1 Node_2\n\n"
+        << "VAL_TABLE_ Table 1 \"On\" 0 \"Off\" ;\n\n\n";
+    for (unsigned int id = 0; id < 1000; ++id) {
+        oss << "BO_ " << id << " Message_" << id << ": 8 Node_1\n"
+            << " SG_ Signal_0 : 0|8@1+ (1,0) [0|255] \"unit\" Node_2\n"
+            << " SG_ Switch M : 8|8@1+ (1,0) [0|255] \"\" Vector__XXX\n"
+            << " SG_ Signal_2 m1 : 16|8@0- (0.5,-1) [-10|10] \"\" Node_1,Node_2\n\n";
+        if (id == 500)
+            oss << "// comment in messages section\n\n";
+    }
+    oss << "BO_ 5 Message_5_Redefined: 4 Node_2\n"
+        << " SG_ Signal_0 : 0|16@1+ (2,0) [0|0] \"\" Node_1\n\n"
+        << "BO_TX_BU_ 1 : Node_1,Node_2;\n\n"
+        << "CM_ \"Network\";\n"
+        << "CM_ BO_ 2 \"Message\";\n"
+        << "CM_ SG_ 3 Signal_0 \"Signal\nover two lines\";\n"
+        << "CM_ SG_ 5000 Missing \"Signal of undefined message\";\n"
+        << "BA_DEF_ BO_  \"MessageAttribute\" INT 0 10;\n"
+        << "BA_DEF_ SG_  \"SignalAttribute\" INT 0 10;\n"
+        << "BA_DEF_DEF_  \"MessageAttribute\" 1;\n"
+        << "BA_DEF_DEF_  \"SignalAttribute\" 1;\n"
+        << "BA_ \"MessageAttribute\" BO_ 4 5;\n"
+        << "BA_ \"SignalAttribute\" SG_ 999 Signal_2 7;\n"
+        << "VAL_ 6 Signal_0 1 \"On\" 0 \"Off\" ;\n"
+        << "SIG_GROUP_ 7 Group 1 : Signal_0 Signal_2;\n"
+        << "SIG_VALTYPE_ 8 Signal_0 : 1;\n"
+        << "SG_MUL_VAL_ 9 Signal_2 Switch 1-1, 3-5;\n";
+    const std::string text = oss.str();
+
+    /* load sequentially */
+    Vector::DBC::Network sequentialNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadBuffer(sequentialNetwork, text.data(), text.size()));
+    BOOST_REQUIRE_EQUAL(sequentialNetwork.messages.size(), 1001);
+    BOOST_CHECK_EQUAL(sequentialNetwork.messages[5].name, "Message_5_Redefined");
+    std::ostringstream sequentialOutput;
+    sequentialOutput << sequentialNetwork;
+
+    /* load in parallel, which replaces the network instead of extending it */
+    Vector::DBC::Network parallelNetwork;
+    parallelNetwork.nodes["Sequential"];
+    BOOST_REQUIRE(Vector::DBC::loadBuffer(parallelNetwork, text.data(), text.size(), 4));
+    BOOST_CHECK_EQUAL(parallelNetwork.nodes.count("Sequential"), 0);
+    std::ostringstream parallelOutput;
+    parallelOutput << parallelNetwork;
+    BOOST_CHECK(parallelOutput.str() == sequentialOutput.str());
+    BOOST_CHECK_EQUAL(parallelNetwork.messages[3].signals["Signal_0"].comment, "Signal\nover two lines");
+    BOOST_CHECK_EQUAL(parallelNetwork.messages[3].signals["Signal_0"].startBit, 0);
+    BOOST_CHECK_EQUAL(parallelNetwork.messages[9].signals["Signal_2"].extendedMultiplexors["Switch"].valueRanges.size(), 2);
+
+    /* invalid input fails like the sequential parser */
+    std::string invalidText = text;
+    invalidText.replace(invalidText.find("BO_ 700 "), 3, "XX_");
+    Vector::DBC::Network invalidNetwork;
+    BOOST_CHECK(!Vector::DBC::loadBuffer(invalidNetwork, invalidText.data(), invalidText.size(), 4));
+    BOOST_CHECK(!invalidNetwork.successfullyParsed);
+
+    /* unmatched characters are reported like by the sequential parser */
+    std::string unmatchedText = text;
+    unmatchedText.insert(unmatchedText.find("BO_ 700 ") + 8, "#");
+    Vector::DBC::Network unmatchedNetwork;
+    unmatchedNetwork.nodes["Sequential"];
+    std::ostringstream errors;
+    std::streambuf * cerrBuffer = std::cerr.rdbuf(errors.rdbuf());
+    const bool unmatchedParsed = Vector::DBC::loadBuffer(unmatchedNetwork, unmatchedText.data(), unmatchedText.size(), 4);
+    std::cerr.rdbuf(cerrBuffer);
+    BOOST_CHECK(unmatchedParsed);
+    BOOST_CHECK_EQUAL(errors.str(), "unmatched character: #");
+    BOOST_CHECK_EQUAL(unmatchedNetwork.nodes.count("Sequential"), 1);
+    BOOST_CHECK_EQUAL(unmatchedNetwork.messages.size(), 1001);
+}
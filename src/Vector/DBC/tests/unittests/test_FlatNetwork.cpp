@@ -0,0 +1,143 @@
+#define BOOST_TEST_MODULE FlatNetwork
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+BOOST_AUTO_TEST_CASE(Database) {
+    Vector::DBC::Network network;
+    BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    const Vector::DBC::FlatNetwork flatNetwork(network);
+
+    /* same messages and signals in the same order */
+    BOOST_REQUIRE_EQUAL(flatNetwork.messages().size(), network.messages.size());
+    std::size_t signalCount = 0;
+    auto messageIt = network.messages.begin();
+    for (const Vector::DBC::FlatMessage & flatMessage : flatNetwork.messages()) {
+        const Vector::DBC::Message & message = messageIt->second;
+        BOOST_CHECK_EQUAL(flatMessage.key, messageIt->first);
+        BOOST_CHECK_EQUAL(flatMessage.id, message.id);
+        BOOST_CHECK_EQUAL(flatMessage.name, message.name);
+        BOOST_CHECK_EQUAL(flatMessage.size, message.size);
+        BOOST_CHECK_EQUAL(flatMessage.transmitter, message.transmitter);
+        BOOST_CHECK_EQUAL(flatMessage.comment, message.comment);
+        BOOST_CHECK_EQUAL(flatMessage.attributeValues.size(), message.attributeValues.size());
+        BOOST_CHECK_EQUAL(flatMessage.firstSignal, signalCount);
+        BOOST_REQUIRE_EQUAL(flatNetwork.signals(flatMessage).size(), message.signals.size());
+        auto signalIt = message.signals.begin();
+        for (const Vector::DBC::Signal & signal : flatNetwork.signals(flatMessage)) {
+            BOOST_CHECK_EQUAL(signal.name, signalIt->second.name);
+            BOOST_CHECK_EQUAL(signal.startBit, signalIt->second.startBit);
+            BOOST_CHECK_EQUAL(signal.comment, signalIt->second.comment);
+            ++signalIt;
+        }
+        signalCount += message.signals.size();
+        ++messageIt;
+    }
+    BOOST_CHECK_EQUAL(flatNetwork.signals().size(), signalCount);
+
+    /* find messages */
+    const Vector::DBC::FlatMessage * message = flatNetwork.findMessage(0xC0000000);
+    BOOST_REQUIRE(message != nullptr);
+    BOOST_CHECK_EQUAL(message->name, "VECTOR__INDEPENDENT_SIG_MSG");
+    BOOST_CHECK(flatNetwork.findMessage("VECTOR__INDEPENDENT_SIG_MSG") == message);
+    BOOST_CHECK(flatNetwork.findMessage(1) == flatNetwork.findMessage("Standard_Message_1"));
+    BOOST_CHECK(flatNetwork.findMessage(3) == nullptr);
+    BOOST_CHECK(flatNetwork.findMessage("Unknown_Message") == nullptr);
+
+    /* find signals */
+    const Vector::DBC::Signal * signal = flatNetwork.findSignal(*message, "Signal_8_Motorola_Signed");
+    BOOST_REQUIRE(signal != nullptr);
+    BOOST_CHECK(signal->byteOrder == Vector::DBC::ByteOrder::BigEndian);
+    BOOST_CHECK(signal->valueType == Vector::DBC::ValueType::Signed);
+    BOOST_CHECK(flatNetwork.findSignal(*message, "Signal_8") == nullptr);
+
+    /* copy is independent of the network */
+    network.messages.clear();
+    BOOST_CHECK(flatNetwork.findSignal(*flatNetwork.findMessage("Extended_Message_1"), "Signal_8") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ReferencedOnly) {
+    /* messages and signals, which are only referenced by CM_ and VAL_, have no identifier or name */
+    std::istringstream iss(
+        "VERSION \"\"\r\n"
+        "\r\n"
+        "NS_ :\r\n"
+        "\r\n"
+        "BS_:\r\n"
+        "\r\n"
+        "BU_:\r\n"
+        "\r\n"
+        "BO_ 100 M100: 8 Vector__XXX\r\n"
+        " SG_ A : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\r\n"
+        "\r\n"
+        "CM_ BO_ 200 \"undefined message\";\r\n"
+        "CM_ SG_ 100 B \"undefined signal\";\r\n"
+        "VAL_ 50 C 0 \"Off\" ;\r\n");
+    Vector::DBC::Network network;
+    iss >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+    BOOST_REQUIRE_EQUAL(network.messages.size(), 3);
+    const Vector::DBC::FlatNetwork flatNetwork(network);
+
+    /* keys are found, although identifiers and names are not set */
+    const Vector::DBC::FlatMessage * message100 = flatNetwork.findMessage(100);
+    BOOST_REQUIRE(message100 != nullptr);
+    BOOST_CHECK_EQUAL(message100->name, "M100");
+    const Vector::DBC::FlatMessage * message200 = flatNetwork.findMessage(200);
+    BOOST_REQUIRE(message200 != nullptr);
+    BOOST_CHECK_EQUAL(message200->comment, "undefined message");
+    BOOST_CHECK(flatNetwork.findMessage(50) != nullptr);
+    const Vector::DBC::Signal * signalA = flatNetwork.findSignal(*message100, "A");
+    BOOST_REQUIRE(signalA != nullptr);
+    BOOST_CHECK_EQUAL(signalA->name, "A");
+    const Vector::DBC::Signal * signalB = flatNetwork.findSignal(*message100, "B");
+    BOOST_REQUIRE(signalB != nullptr);
+    BOOST_CHECK_EQUAL(signalB->comment, "undefined signal");
+    BOOST_CHECK(flatNetwork.findSignal(*flatNetwork.findMessage(50), "C") != nullptr);
+    BOOST_CHECK(flatNetwork.findSignal(*message100, "C") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(CompiledSignals) {
+    Vector::DBC::Network network;
+    BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    const Vector::DBC::FlatNetwork flatNetwork(network);
+
+    /* hot decode data is compact */
+    BOOST_CHECK_LE(sizeof(Vector::DBC::CompiledSignal), 48);
+    BOOST_CHECK_LT(sizeof(Vector::DBC::CompiledSignal), sizeof(Vector::DBC::Signal));
+    BOOST_REQUIRE_EQUAL(flatNetwork.compiledSignals().size(), flatNetwork.signals().size());
+
+    /* compiled signals decode like their signals, which hold the cold data */
+    const std::vector<uint8_t> data { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+    for (const Vector::DBC::FlatMessage & message : flatNetwork.messages()) {
+        BOOST_REQUIRE_EQUAL(flatNetwork.compiledSignals(message).size(), message.signalCount);
+        for (const Vector::DBC::CompiledSignal & compiledSignal : flatNetwork.compiledSignals(message)) {
+            const Vector::DBC::Signal & signal = flatNetwork.signal(compiledSignal);
+            BOOST_CHECK(&signal >= flatNetwork.signals(message).begin());
+            BOOST_CHECK(&signal < flatNetwork.signals(message).end());
+
+            /* compiled signals read dataSize bytes, so zero pad like MessageDecoder does */
+            std::vector<uint8_t> paddedData(data);
+            paddedData.resize(std::max<std::size_t>(data.size(), compiledSignal.dataSize), 0);
+            BOOST_CHECK_EQUAL(compiledSignal.decode(paddedData.data()), signal.decode(data));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const Vector::DBC::FlatNetwork flatNetwork;
+    BOOST_CHECK(flatNetwork.messages().empty());
+    BOOST_CHECK(flatNetwork.signals().empty());
+    BOOST_CHECK(flatNetwork.compiledSignals().empty());
+    BOOST_CHECK(flatNetwork.findMessage(0) == nullptr);
+    BOOST_CHECK(flatNetwork.findMessage("") == nullptr);
+}
@@ -0,0 +1,35 @@
+#define BOOST_TEST_MODULE FrameRecord
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Vector/DBC.h>
+
+/**
+ * Check conversion between data length code and data size.
+ */
+BOOST_AUTO_TEST_CASE(FrameRecordDlc) {
+    /* classic CAN */
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(0, false), 0);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(8, false), 8);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(15, false), 8);
+
+    /* CAN FD */
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(8, true), 8);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(9, true), 12);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(13, true), 32);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(15, true), 64);
+    BOOST_CHECK_EQUAL(Vector::DBC::dlcToDataSize(16, true), 64);
+
+    /* smallest frame, which fits the data */
+    for (std::size_t dataSize = 0; dataSize <= 64; ++dataSize) {
+        const uint8_t dlc = Vector::DBC::dataSizeToDlc(dataSize);
+        BOOST_CHECK_GE(Vector::DBC::dlcToDataSize(dlc, true), dataSize);
+        if (dlc > 0)
+            BOOST_CHECK_LT(Vector::DBC::dlcToDataSize(dlc - 1, true), dataSize);
+    }
+}
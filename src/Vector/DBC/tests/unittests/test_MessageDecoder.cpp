@@ -0,0 +1,403 @@
+#define BOOST_TEST_MODULE MessageDecoder
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/**
+ * Add a signal to a message.
+ */
+static Vector::DBC::Signal & addSignal(Vector::DBC::Message & message, const std::string & name, uint32_t startBit, uint32_t bitSize, Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType valueType, double factor, double offset) {
+    Vector::DBC::Signal & signal = message.signals[name];
+    signal.name = name;
+    signal.startBit = startBit;
+    signal.bitSize = bitSize;
+    signal.byteOrder = byteOrder;
+    signal.valueType = valueType;
+    signal.factor = factor;
+    signal.offset = offset;
+    return signal;
+}
+
+/**
+ * Check that all signals of a message are decoded like Signal::decode does.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecode) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 */
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.id = 0x100;
+    message.name = "Message_1";
+    message.size = 8;
+    addSignal(message, "Signal_1", 0, 12, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 0.5, 10.0);
+    addSignal(message, "Signal_2", 12, 4, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, 1.0, 0.0);
+    addSignal(message, "Signal_3", 23, 16, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed, 0.1, -5.0);
+    addSignal(message, "Signal_4", 63, 8, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+
+    /* define extended message 0x80000200 without signals */
+    network.messages[0x80000200].id = 0x80000200;
+
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    BOOST_REQUIRE_EQUAL(messageDecoder.signalCount(0x100), 4);
+    BOOST_CHECK_EQUAL(messageDecoder.signalCount(0x80000200), 0);
+    BOOST_CHECK_EQUAL(messageDecoder.signalCount(0x200), 0);
+    BOOST_CHECK_EQUAL(messageDecoder.signalIndex(0x100, "Signal_3"), 2);
+    BOOST_CHECK_EQUAL(messageDecoder.signalIndex(0x100, "Signal_5"), -1);
+    BOOST_CHECK_EQUAL(messageDecoder.signalIndex(0x200, "Signal_1"), -1);
+
+    /* decode and compare against Signal */
+    std::vector<uint8_t> data { 0x12, 0xF4, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+    Vector::DBC::SignalValue values[4];
+    BOOST_REQUIRE(messageDecoder.decode(0x100, data.data(), data.size(), values));
+    int index = 0;
+    for (const auto & signal : message.signals) {
+        uint64_t rawValue = signal.second.decode(data);
+        double value = (signal.second.valueType == Vector::DBC::ValueType::Signed) ?
+                       static_cast<double>(static_cast<int64_t>(rawValue)) : static_cast<double>(rawValue);
+        BOOST_CHECK_EQUAL(values[index].rawValue, rawValue);
+        BOOST_CHECK_EQUAL(values[index].physicalValue, signal.second.rawToPhysicalValue(value));
+        ++index;
+    }
+    BOOST_CHECK_EQUAL(values[0].rawValue, 0x412);
+    BOOST_CHECK_EQUAL(values[0].physicalValue, 531.0);
+    BOOST_CHECK_EQUAL(values[1].rawValue, 0xFFFFFFFFFFFFFFFF);
+    BOOST_CHECK_EQUAL(values[1].physicalValue, -1.0);
+
+    /* short data is zero padded */
+    BOOST_REQUIRE(messageDecoder.decode(0x100, data.data(), 2, values));
+    BOOST_CHECK_EQUAL(values[0].rawValue, 0x412);
+    BOOST_CHECK_EQUAL(values[2].rawValue, 0);
+    BOOST_CHECK_EQUAL(values[3].rawValue, 0);
+
+    /* unknown messages are not decoded */
+    BOOST_CHECK(!messageDecoder.decode(0x200, data.data(), data.size(), values));
+    BOOST_CHECK(messageDecoder.decode(0x80000200, data.data(), data.size(), values));
+}
+
+/**
+ * Check that only the signals selected by the multiplexor switch are decoded.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecodeActive) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 with small switch values (direct page table) */
+    Vector::DBC::Message & message1 = network.messages[0x100];
+    message1.id = 0x100;
+    message1.size = 8;
+    addSignal(message1, "A_Static", 56, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    Vector::DBC::Signal & switch1 = addSignal(message1, "B_Switch", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    switch1.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+    Vector::DBC::Signal & page0 = addSignal(message1, "C_Page0", 8, 16, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    page0.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    page0.multiplexerSwitchValue = 0;
+    Vector::DBC::Signal & page2a = addSignal(message1, "D_Page2", 8, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, 2.0, 0.0);
+    page2a.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    page2a.multiplexerSwitchValue = 2;
+    Vector::DBC::Signal & page2b = addSignal(message1, "E_Page2", 16, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    page2b.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    page2b.multiplexerSwitchValue = 2;
+
+    /* define message 0x200 with large switch values (sorted pages) */
+    Vector::DBC::Message & message2 = network.messages[0x200];
+    message2.id = 0x200;
+    message2.size = 8;
+    Vector::DBC::Signal & switch2 = addSignal(message2, "Switch", 7, 16, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    switch2.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+    Vector::DBC::Signal & low = addSignal(message2, "Low", 16, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    low.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    low.multiplexerSwitchValue = 5;
+    Vector::DBC::Signal & high = addSignal(message2, "High", 16, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    high.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    high.multiplexerSwitchValue = 0x1234;
+
+    /* define message 0x300 without multiplexor */
+    Vector::DBC::Message & message3 = network.messages[0x300];
+    message3.id = 0x300;
+    message3.size = 8;
+    addSignal(message3, "Signal_1", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    addSignal(message3, "Signal_2", 8, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    Vector::DBC::SignalValue values[5];
+    uint32_t indices[5];
+
+    /* page 0: switch first, then static, then page signals */
+    std::vector<uint8_t> data { 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x77 };
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 3);
+    BOOST_CHECK_EQUAL(indices[0], 1);
+    BOOST_CHECK_EQUAL(indices[1], 0);
+    BOOST_CHECK_EQUAL(indices[2], 2);
+    BOOST_CHECK_EQUAL(values[0].rawValue, 0x77);
+    BOOST_CHECK_EQUAL(values[1].rawValue, 0);
+    BOOST_CHECK_EQUAL(values[2].rawValue, 0x1234);
+
+    /* page 2 */
+    data[0] = 2;
+    data[1] = 0xFF;
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 4);
+    BOOST_CHECK_EQUAL(indices[2], 3);
+    BOOST_CHECK_EQUAL(indices[3], 4);
+    BOOST_CHECK_EQUAL(values[3].physicalValue, -2.0);
+    BOOST_CHECK_EQUAL(values[4].rawValue, 0x12);
+
+    /* page 1 and values beyond the page table have no multiplexed signals */
+    data[0] = 1;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 2);
+    data[0] = 200;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 2);
+
+    /* sorted pages */
+    std::vector<uint8_t> data2 { 0x12, 0x34, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x200, data2.data(), data2.size(), values, indices), 2);
+    BOOST_CHECK_EQUAL(indices[0], 2);
+    BOOST_CHECK_EQUAL(indices[1], 0);
+    BOOST_CHECK_EQUAL(values[2].rawValue, 0x1234);
+    BOOST_CHECK_EQUAL(values[0].rawValue, 0xAB);
+    data2[0] = 0x00;
+    data2[1] = 0x05;
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x200, data2.data(), data2.size(), values, indices), 2);
+    BOOST_CHECK_EQUAL(indices[1], 1);
+    data2[1] = 0x06;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x200, data2.data(), data2.size(), values, indices), 1);
+
+    /* without multiplexor all signals are active */
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x300, data.data(), data.size(), values, indices), 2);
+    BOOST_CHECK_EQUAL(indices[0], 0);
+    BOOST_CHECK_EQUAL(indices[1], 1);
+
+    /* unknown messages are not decoded */
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x400, data.data(), data.size(), values, indices), 0);
+}
+
+/**
+ * Check that extended multiplexing (SG_MUL_VAL_) is evaluated along the switch chain.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecodeExtendedMultiplexing) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 with nested switches */
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.id = 0x100;
+    message.size = 8;
+    Vector::DBC::Signal & switch1 = addSignal(message, "Switch_1", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    switch1.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+    Vector::DBC::Signal & switch2 = addSignal(message, "Switch_2", 8, 16, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    switch2.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    switch2.extendedMultiplexors["Switch_1"].switchName = "Switch_1";
+    switch2.extendedMultiplexors["Switch_1"].valueRanges = { { 0, 0 } };
+    Vector::DBC::Signal & signal1 = addSignal(message, "Signal_1", 8, 16, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    signal1.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    signal1.extendedMultiplexors["Switch_1"].switchName = "Switch_1";
+    signal1.extendedMultiplexors["Switch_1"].valueRanges = { { 1, 1 }, { 5, 10 } };
+    Vector::DBC::Signal & signal2 = addSignal(message, "Signal_2", 24, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    signal2.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    signal2.extendedMultiplexors["Switch_2"].switchName = "Switch_2";
+    signal2.extendedMultiplexors["Switch_2"].valueRanges = { { 2, 4 } };
+    Vector::DBC::Signal & signal3 = addSignal(message, "Signal_3", 32, 16, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 0.5, 0.0);
+    signal3.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    signal3.extendedMultiplexors["Switch_2"].switchName = "Switch_2";
+    signal3.extendedMultiplexors["Switch_2"].valueRanges = { { 3, 3 }, { 100, 200 }, { 2000, 3000 } };
+    addSignal(message, "Signal_4", 56, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+
+    /* signals are ordered by name */
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    BOOST_REQUIRE_EQUAL(messageDecoder.signalIndex(0x100, "Switch_1"), 4);
+    BOOST_REQUIRE_EQUAL(messageDecoder.signalIndex(0x100, "Switch_2"), 5);
+    Vector::DBC::SignalValue values[6];
+    uint32_t indices[6];
+
+    /* Switch_1 selects Switch_2, which selects Signal_2 and Signal_3 */
+    std::vector<uint8_t> data { 0x00, 0x03, 0x00, 0x11, 0x22, 0x00, 0x00, 0x44 };
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 5);
+    BOOST_CHECK_EQUAL(indices[0], 4);
+    BOOST_CHECK_EQUAL(indices[1], 3);
+    BOOST_CHECK_EQUAL(indices[2], 5);
+    BOOST_CHECK_EQUAL(indices[3], 1);
+    BOOST_CHECK_EQUAL(indices[4], 2);
+    BOOST_CHECK_EQUAL(values[1].rawValue, 0x11);
+    BOOST_CHECK_EQUAL(values[2].physicalValue, 17.0);
+    BOOST_CHECK_EQUAL(values[3].rawValue, 0x44);
+
+    /* Switch_2 ranges beyond the direct table */
+    data[1] = 0xC4;
+    data[2] = 0x09;
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 4);
+    BOOST_CHECK_EQUAL(indices[3], 2);
+    data[1] = 0xB9;
+    data[2] = 0x0B;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 3);
+    data[1] = 150;
+    data[2] = 0x00;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 4);
+
+    /* Switch_1 selects Signal_1 */
+    data[0] = 7;
+    BOOST_REQUIRE_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 3);
+    BOOST_CHECK_EQUAL(indices[2], 0);
+    BOOST_CHECK_EQUAL(values[0].rawValue, 150);
+    data[0] = 11;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeActive(0x100, data.data(), data.size(), values, indices), 2);
+}
+
+/**
+ * Check that batch decoding produces the same values as per-frame decoding.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecodeBatch) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 without multiplexor */
+    Vector::DBC::Message & message1 = network.messages[0x100];
+    message1.id = 0x100;
+    message1.size = 8;
+    addSignal(message1, "Signal_1", 0, 12, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 0.5, 10.0);
+    addSignal(message1, "Signal_2", 23, 16, Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Signed, 0.1, -5.0);
+
+    /* define extended message 0x80000200 with multiplexor */
+    Vector::DBC::Message & message2 = network.messages[0x80000200];
+    message2.id = 0x80000200;
+    message2.size = 8;
+    Vector::DBC::Signal & switch2 = addSignal(message2, "Switch", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    switch2.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexorSwitch;
+    Vector::DBC::Signal & page1 = addSignal(message2, "Page_1", 8, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    page1.multiplexor = Vector::DBC::Signal::Multiplexor::MultiplexedSignal;
+    page1.multiplexerSwitchValue = 1;
+
+    /* interleaved frames, including unknown messages and short data */
+    std::vector<std::vector<uint8_t>> payloads;
+    std::vector<Vector::DBC::FrameRecord> frames;
+    for (uint32_t i = 0; i < 100; ++i) {
+        std::vector<uint8_t> payload;
+        for (uint32_t b = 0; b < 8; ++b)
+            payload.push_back(static_cast<uint8_t>(i * 37 + b * 11));
+        payload[0] = static_cast<uint8_t>(i % 3);
+        payloads.push_back(payload);
+    }
+    for (uint32_t i = 0; i < 100; ++i) {
+        Vector::DBC::FrameRecord frame;
+        frame.timestamp = 1000 + i;
+        frame.id = (i % 3 == 0) ? 0x100 : ((i % 3 == 1) ? 0x80000200 : 0x300);
+        frame.dlc = (i % 10 == 0) ? 2 : 8;
+        frame.data = payloads[i].data();
+        frames.push_back(frame);
+    }
+
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    BOOST_REQUIRE_EQUAL(messageDecoder.columnCount(), 4);
+    std::vector<Vector::DBC::SignalColumn> columns;
+    BOOST_CHECK_EQUAL(messageDecoder.decodeBatch(frames.data(), frames.size(), columns), 67);
+    BOOST_REQUIRE_EQUAL(columns.size(), 4);
+
+    /* compare with per-frame decoding */
+    std::vector<std::size_t> positions(columns.size(), 0);
+    for (const auto & frame : frames) {
+        Vector::DBC::SignalValue values[3];
+        uint32_t indices[3];
+        const std::size_t count = messageDecoder.decodeActive(frame.id, frame.data, frame.dlc, values, indices);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t c = ((frame.id == 0x100) ? 0 : 2) + indices[i];
+            BOOST_REQUIRE_LT(positions[c], columns[c].values.size());
+            BOOST_CHECK_EQUAL(columns[c].timestamps[positions[c]], frame.timestamp);
+            BOOST_CHECK_EQUAL(columns[c].values[positions[c]], values[indices[i]].physicalValue);
+            ++positions[c];
+        }
+    }
+    for (std::size_t c = 0; c < columns.size(); ++c)
+        BOOST_CHECK_EQUAL(positions[c], columns[c].values.size());
+
+    /* columns of signals */
+    BOOST_CHECK_EQUAL(messageDecoder.columnIndex(0x100, "Signal_2"), 1);
+    BOOST_CHECK_EQUAL(messageDecoder.columnIndex(0x80000200, "Page_1"), 2);
+    BOOST_CHECK_EQUAL(messageDecoder.columnIndex(0x80000200, "Signal_2"), -1);
+    BOOST_CHECK_EQUAL(columns[0].values.size(), 34);
+    BOOST_CHECK_EQUAL(columns[3].values.size(), 33);
+
+    /* values are appended */
+    BOOST_CHECK_EQUAL(messageDecoder.decodeBatch(frames.data(), frames.size(), columns), 67);
+    BOOST_CHECK_EQUAL(columns[0].values.size(), 68);
+}
+
+/**
+ * Check decoding of CAN FD frames of different sizes.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecodeCanFd) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 with signals up to byte 63 */
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.id = 0x100;
+    message.size = 64;
+    addSignal(message, "Signal_1", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    addSignal(message, "Signal_2", 248, 16, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    addSignal(message, "Signal_3", 504, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    uint8_t data[64];
+    for (std::size_t i = 0; i < sizeof(data); ++i)
+        data[i] = static_cast<uint8_t>(i + 1);
+
+    /* all frame sizes decode like Signal::decode */
+    for (std::size_t size : { 0, 8, 12, 31, 32, 48, 64 }) {
+        Vector::DBC::SignalValue values[3];
+        BOOST_REQUIRE(messageDecoder.decode(0x100, data, size, values));
+        int index = 0;
+        for (const auto & signal : message.signals) {
+            BOOST_CHECK_EQUAL(values[index].rawValue, signal.second.decode(data, size));
+            ++index;
+        }
+    }
+}
+
+/**
+ * Check that enum signals decode to their value descriptions.
+ */
+BOOST_AUTO_TEST_CASE(MessageDecoderDecodeLabels) {
+    Vector::DBC::Network network;
+
+    /* define message 0x100 with two enum signals and a plain signal */
+    Vector::DBC::Message & message = network.messages[0x100];
+    message.id = 0x100;
+    message.size = 8;
+    Vector::DBC::Signal & signal1 = addSignal(message, "Signal_1", 0, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+    signal1.valueDescriptions[0] = "Off";
+    signal1.valueDescriptions[1] = "On";
+    Vector::DBC::Signal & signal2 = addSignal(message, "Signal_2", 8, 4, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Signed, 1.0, 0.0);
+    signal2.valueDescriptions[0xFFFFFFFF] = "Reverse";
+    signal2.valueDescriptions[1] = "Forward";
+    addSignal(message, "Signal_3", 16, 8, Vector::DBC::ByteOrder::LittleEndian, Vector::DBC::ValueType::Unsigned, 1.0, 0.0);
+
+    /* define trailing message 0x200 without signals */
+    network.messages[0x200].id = 0x200;
+
+    Vector::DBC::MessageDecoder messageDecoder(network);
+    BOOST_CHECK(messageDecoder.valueDescriptionTable(0x100, 0).isDense());
+    BOOST_CHECK(!messageDecoder.valueDescriptionTable(0x100, 1).isDense());
+    BOOST_CHECK(messageDecoder.valueDescriptionTable(0x100, 2).empty());
+    BOOST_CHECK(messageDecoder.valueDescriptionTable(0x200, 0).empty());
+    BOOST_CHECK(messageDecoder.valueDescriptionTable(0x300, 0).empty());
+
+    const std::vector<uint8_t> data1 { 0x01, 0x0F, 0x01, 0, 0, 0, 0, 0 };
+    Vector::DBC::StringView labels[3];
+    BOOST_REQUIRE(messageDecoder.decodeLabels(0x100, data1, labels));
+    BOOST_CHECK_EQUAL(labels[0], "On");
+    BOOST_CHECK_EQUAL(labels[1], "Reverse");
+    BOOST_CHECK(labels[2].empty());
+
+    /* short data is zero padded, values without description are empty */
+    const std::vector<uint8_t> data2 { 0x02, 0x01 };
+    BOOST_REQUIRE(messageDecoder.decodeLabels(0x100, data2, labels));
+    BOOST_CHECK(labels[0].empty());
+    BOOST_CHECK_EQUAL(labels[1], "Forward");
+
+    /* message without signals */
+    BOOST_CHECK(messageDecoder.decodeLabels(0x200, data1, labels));
+
+    /* unknown message */
+    BOOST_CHECK(!messageDecoder.decodeLabels(0x300, data1, labels));
+}
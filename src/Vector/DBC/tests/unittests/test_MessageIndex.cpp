@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE MessageIndex
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include <Vector/DBC.h>
+
+/**
+ * Check that all messages are found and unknown ones are not.
+ */
+BOOST_AUTO_TEST_CASE(MessageIndexFind) {
+    Vector::DBC::Network network;
+
+    /* standard and extended messages with the same CAN identifiers */
+    for (uint32_t id = 0; id < 0x800; id += 3) {
+        network.messages[id].id = id;
+        network.messages[id].name = "Standard_" + std::to_string(id);
+        network.messages[id | 0x80000000].id = id | 0x80000000;
+        network.messages[id | 0x80000000].name = "Extended_" + std::to_string(id);
+    }
+    network.messages[0x9FFFFFFF].id = 0x9FFFFFFF;
+
+    Vector::DBC::MessageIndex messageIndex(network);
+    BOOST_CHECK_EQUAL(messageIndex.size(), network.messages.size());
+
+    /* all messages are found at their position */
+    int position = 0;
+    for (const auto & message : network.messages) {
+        BOOST_CHECK_EQUAL(messageIndex.find(message.first), &message.second);
+        BOOST_CHECK_EQUAL(messageIndex.position(message.first), position);
+        ++position;
+    }
+
+    /* standard and extended frames are distinguished */
+    BOOST_CHECK_EQUAL(messageIndex.find(0x123, false)->name, "Standard_291");
+    BOOST_CHECK_EQUAL(messageIndex.find(0x123, true)->name, "Extended_291");
+    BOOST_CHECK_EQUAL(messageIndex.find(0x1FFFFFFF, true), &network.messages[0x9FFFFFFF]);
+
+    /* unknown messages */
+    BOOST_CHECK(messageIndex.find(0x124) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x80000124) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x1FFFFFFF) == nullptr);
+    BOOST_CHECK_EQUAL(messageIndex.position(0x124), -1);
+
+    /* empty index */
+    Vector::DBC::MessageIndex emptyIndex;
+    BOOST_CHECK(emptyIndex.find(0) == nullptr);
+    BOOST_CHECK_EQUAL(emptyIndex.size(), 0);
+    Vector::DBC::MessageIndex emptyNetworkIndex{Vector::DBC::Network()};
+    BOOST_CHECK(emptyNetworkIndex.find(0) == nullptr);
+}
+
+/**
+ * Check the direct table for standard identifiers.
+ */
+BOOST_AUTO_TEST_CASE(MessageIndexStandardTable) {
+    Vector::DBC::Network network;
+    for (uint32_t id = 0; id < 0x800; id += 2)
+        network.messages[id].id = id;
+    network.messages[0x800].id = 0x800;
+    network.messages[0x80000001].id = 0x80000001;
+    network.messages[0x80000002].id = 0x80000002;
+
+    Vector::DBC::MessageIndex messageIndex(network, true);
+    BOOST_CHECK_EQUAL(messageIndex.size(), network.messages.size());
+
+    /* all messages are found at their position */
+    int position = 0;
+    for (const auto & message : network.messages) {
+        BOOST_CHECK_EQUAL(messageIndex.find(message.first), &message.second);
+        BOOST_CHECK_EQUAL(messageIndex.position(message.first), position);
+        ++position;
+    }
+
+    /* unknown messages */
+    BOOST_CHECK(messageIndex.find(0x001) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x7FF) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x801) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x80000000) == nullptr);
+    BOOST_CHECK(messageIndex.find(0x1, true) == &network.messages[0x80000001]);
+
+    /* network with standard frames only */
+    Vector::DBC::Network standardNetwork;
+    standardNetwork.messages[0x7FF].id = 0x7FF;
+    Vector::DBC::MessageIndex standardIndex(standardNetwork, true);
+    BOOST_CHECK(standardIndex.find(0x7FF) == &standardNetwork.messages[0x7FF]);
+    BOOST_CHECK(standardIndex.find(0x800007FF) == nullptr);
+}
+
+/**
+ * Check that an index of only positions outlives the network.
+ */
+BOOST_AUTO_TEST_CASE(MessageIndexPositions) {
+    Vector::DBC::MessageIndex messageIndex;
+    {
+        Vector::DBC::Network network;
+        for (uint32_t id = 0; id < 0x1000; id += 5)
+            network.messages[id].id = id;
+        messageIndex = Vector::DBC::MessageIndex(network, true, Vector::DBC::MessageIndex::Content::Positions);
+    }
+
+    /* positions are found, messages aren't referred to */
+    BOOST_CHECK_EQUAL(messageIndex.size(), 820);
+    BOOST_CHECK_EQUAL(messageIndex.position(0), 0);
+    BOOST_CHECK_EQUAL(messageIndex.position(0x7FD), 409);
+    BOOST_CHECK_EQUAL(messageIndex.position(0xFFF), 819);
+    BOOST_CHECK_EQUAL(messageIndex.position(0x7FE), -1);
+    BOOST_CHECK(messageIndex.find(0) == nullptr);
+    BOOST_CHECK(messageIndex.find(0xFFF) == nullptr);
+}
@@ -0,0 +1,167 @@
+#define BOOST_TEST_MODULE NetworkView
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+#include "AlignedSnapshot.h"
+
+/** compare views with network */
+static void checkNetworkView(const Vector::DBC::Network & network, const Vector::DBC::NetworkView & networkView) {
+    BOOST_CHECK_EQUAL(networkView.version(), network.version);
+    BOOST_CHECK_EQUAL(networkView.comment(), network.comment);
+    BOOST_REQUIRE_EQUAL(networkView.messageCount(), network.messages.size());
+    for (const auto & message : network.messages) {
+        /* find message by identifier and name */
+        const Vector::DBC::MessageView messageView = networkView.findMessage(message.first);
+        BOOST_REQUIRE(messageView.isValid());
+        BOOST_CHECK_EQUAL(messageView.id(), message.second.id);
+        BOOST_CHECK_EQUAL(messageView.name(), message.second.name);
+        BOOST_CHECK_EQUAL(messageView.size(), message.second.size);
+        BOOST_CHECK_EQUAL(messageView.transmitter(), message.second.transmitter);
+        BOOST_CHECK_EQUAL(messageView.comment(), message.second.comment);
+        BOOST_CHECK_EQUAL(messageView.transmitterCount(), message.second.transmitters.size());
+        BOOST_CHECK_EQUAL(networkView.findMessage(message.second.name).id(), message.second.id);
+
+        /* find signal by name */
+        BOOST_REQUIRE_EQUAL(messageView.signalCount(), message.second.signals.size());
+        for (const auto & signal : message.second.signals) {
+            const Vector::DBC::SignalView signalView = messageView.findSignal(signal.first);
+            BOOST_REQUIRE(signalView.isValid());
+            BOOST_CHECK_EQUAL(signalView.name(), signal.second.name);
+            BOOST_CHECK_EQUAL(signalView.startBit(), signal.second.startBit);
+            BOOST_CHECK_EQUAL(signalView.bitSize(), signal.second.bitSize);
+            BOOST_CHECK(signalView.byteOrder() == signal.second.byteOrder);
+            BOOST_CHECK(signalView.valueType() == signal.second.valueType);
+            BOOST_CHECK(signalView.multiplexor() == signal.second.multiplexor);
+            BOOST_CHECK_EQUAL(signalView.factor(), signal.second.factor);
+            BOOST_CHECK_EQUAL(signalView.offset(), signal.second.offset);
+            BOOST_CHECK_EQUAL(signalView.minimum(), signal.second.minimum);
+            BOOST_CHECK_EQUAL(signalView.maximum(), signal.second.maximum);
+            BOOST_CHECK_EQUAL(signalView.unit(), signal.second.unit);
+            BOOST_CHECK_EQUAL(signalView.comment(), signal.second.comment);
+            BOOST_REQUIRE_EQUAL(signalView.receiverCount(), signal.second.receivers.size());
+            std::size_t index = 0;
+            for (const std::string & receiver : signal.second.receivers)
+                BOOST_CHECK_EQUAL(signalView.receiver(index++), receiver);
+            for (const auto & valueDescription : signal.second.valueDescriptions)
+                BOOST_CHECK_EQUAL(signalView.valueDescription(valueDescription.first), valueDescription.second);
+        }
+        BOOST_CHECK(!messageView.findSignal("Unknown").isValid());
+    }
+    BOOST_CHECK(!networkView.findMessage(0x7fffffff).isValid());
+    BOOST_CHECK(!networkView.findMessage("Unknown").isValid());
+}
+
+BOOST_AUTO_TEST_CASE(Database) {
+    Vector::DBC::Network network;
+    BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    std::ostringstream oss;
+    BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, oss));
+    AlignedSnapshot data(oss.str());
+
+    /* with lookup tables */
+    Vector::DBC::Snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(data.data(), data.size));
+    BOOST_REQUIRE(!snapshot.records<Vector::DBC::SnapshotFormat::MessageIdSlot>().empty());
+    checkNetworkView(network, Vector::DBC::NetworkView(snapshot));
+
+    /* without lookup tables */
+    Vector::DBC::SnapshotFormat::Header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    for (uint32_t i = 0; i < header.sectionCount; ++i) {
+        Vector::DBC::SnapshotFormat::Section * section = reinterpret_cast<Vector::DBC::SnapshotFormat::Section *>(data.data() + sizeof(header)) + i;
+        if ((section->type == Vector::DBC::SnapshotFormat::SectionType::MessageIds) ||
+                (section->type == Vector::DBC::SnapshotFormat::SectionType::MessageNames))
+            section->count = 0;
+    }
+    Vector::DBC::Snapshot snapshotWithoutLookup;
+    BOOST_REQUIRE(snapshotWithoutLookup.open(data.data(), data.size));
+    BOOST_REQUIRE(snapshotWithoutLookup.records<Vector::DBC::SnapshotFormat::MessageIdSlot>().empty());
+    checkNetworkView(network, Vector::DBC::NetworkView(snapshotWithoutLookup));
+}
+
+BOOST_AUTO_TEST_CASE(Decode) {
+    std::istringstream iss(
+        "VERSION \"\"\n\nNS_ :\n\nBS_:\n\nBU_: Node_1\n\n"
+        "BO_ 2147483748 Message_1: 8 Node_1\n"
+        " SG_ Signal_1 : 7|12@0- (0.5,-1) [0|0] \"\" Node_1\n"
+        " SG_ Signal_2 : 16|4@1+ (1,0) [0|0] \"\" Node_1\n\n"
+        "VAL_ 2147483748 Signal_2 1 \"On\" 0 \"Off\" ;\n");
+    Vector::DBC::Network network;
+    iss >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+    std::ostringstream oss;
+    BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, oss));
+    AlignedSnapshot data(oss.str());
+    Vector::DBC::Snapshot snapshot;
+    BOOST_REQUIRE(snapshot.open(data.data(), data.size));
+    Vector::DBC::NetworkView networkView(snapshot);
+
+    /* decode with compiled signals from the views */
+    const Vector::DBC::MessageView messageView = networkView.findMessage("Message_1");
+    BOOST_REQUIRE(messageView.isValid());
+    BOOST_CHECK_EQUAL(messageView.id(), 0x80000064);
+    const std::array<uint8_t, 8> frame { { 0xAB, 0xC0, 0x01, 0, 0, 0, 0, 0 } };
+    for (const auto & signal : network.messages[0x80000064].signals) {
+        const Vector::DBC::SignalView signalView = messageView.findSignal(signal.first);
+        BOOST_REQUIRE(signalView.isValid());
+        BOOST_CHECK_EQUAL(signalView.compile().decode(frame.data()), signal.second.decode(frame));
+    }
+    BOOST_CHECK_EQUAL(messageView.findSignal("Signal_2").valueDescription(1), "On");
+    BOOST_CHECK(messageView.findSignal("Signal_2").valueDescription(2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Unopened) {
+    /* view on a snapshot, which isn't open, is empty */
+    const Vector::DBC::Snapshot snapshot;
+    BOOST_REQUIRE(!snapshot.isOpen());
+    const Vector::DBC::NetworkView networkView(snapshot);
+    BOOST_CHECK(networkView.version().empty());
+    BOOST_CHECK_EQUAL(networkView.messageCount(), 0);
+    BOOST_CHECK(!networkView.findMessage(1).isValid());
+    BOOST_CHECK(!networkView.findMessage("Message_1").isValid());
+}
+
+BOOST_AUTO_TEST_CASE(Corrupted) {
+    Vector::DBC::Network network;
+    BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    std::ostringstream oss;
+    BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, oss));
+    const std::string snapshot = oss.str();
+
+    /* network version outside of string section */
+    Vector::DBC::Snapshot validSnapshot;
+    AlignedSnapshot valid(snapshot);
+    BOOST_REQUIRE(validSnapshot.open(valid.data(), valid.size));
+    const Vector::DBC::SnapshotFormat::NetworkRecord * networkRecord = validSnapshot.records<Vector::DBC::SnapshotFormat::NetworkRecord>().data();
+    const std::size_t versionOffset = reinterpret_cast<const char *>(&networkRecord->version) - valid.data();
+    std::string corrupted = snapshot;
+    const uint32_t invalidOffset = 0x7fff0000;
+    std::memcpy(&corrupted[versionOffset + offsetof(Vector::DBC::SnapshotFormat::String, offset)], &invalidOffset, sizeof(invalidOffset));
+
+    /* view on a snapshot, which failed to open, is empty */
+    AlignedSnapshot invalid(corrupted);
+    Vector::DBC::Snapshot invalidSnapshot;
+    BOOST_REQUIRE(!invalidSnapshot.open(invalid.data(), invalid.size));
+    BOOST_CHECK(invalidSnapshot.records<Vector::DBC::SnapshotFormat::NetworkRecord>().empty());
+    const Vector::DBC::NetworkView networkView(invalidSnapshot);
+    BOOST_CHECK(networkView.version().empty());
+    BOOST_CHECK_EQUAL(networkView.messageCount(), 0);
+    BOOST_CHECK(!networkView.findMessage(1).isValid());
+    BOOST_CHECK(!networkView.findMessage("Message_1").isValid());
+
+    /* reopening a valid snapshot after a failed one works */
+    BOOST_REQUIRE(invalidSnapshot.open(valid.data(), valid.size));
+    checkNetworkView(network, Vector::DBC::NetworkView(invalidSnapshot));
+}
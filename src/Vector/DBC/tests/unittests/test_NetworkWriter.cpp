@@ -0,0 +1,145 @@
+#define BOOST_TEST_MODULE NetworkWriter
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/** output of operator<< */
+static std::string streamOutput(const Vector::DBC::Network & network) {
+    std::ostringstream oss;
+    oss << network;
+    return oss.str();
+}
+
+/** number as formatted by streams with precision 16 in C locale */
+static std::string streamNumber(double value) {
+    std::ostringstream oss;
+    oss.imbue(std::locale("C"));
+    oss.precision(16);
+    oss << value;
+    return oss.str();
+}
+
+BOOST_AUTO_TEST_CASE(Files) {
+    for (const char * fileName : {
+        CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc",
+        CMAKE_CURRENT_SOURCE_DIR "/data/ExtendedMultiplexing.dbc",
+        CMAKE_CURRENT_SOURCE_DIR "/data/MessageSeparation.dbc" }) {
+        Vector::DBC::Network network;
+        BOOST_REQUIRE(Vector::DBC::loadFile(network, fileName));
+        const std::string expected = streamOutput(network);
+
+        /* buffer, which is the same as operator<< delegating to the writer */
+        Vector::DBC::NetworkWriter writer;
+        BOOST_CHECK(writer.write(network));
+        BOOST_CHECK(writer.buffer() == expected);
+
+        /* sink with small blocks */
+        std::string output;
+        std::size_t blockCount = 0;
+        Vector::DBC::NetworkWriter sinkWriter([&](const char * data, std::size_t size) {
+            output.append(data, size);
+            ++blockCount;
+            return true;
+        }, 0x100);
+        BOOST_CHECK(sinkWriter.write(network));
+        BOOST_CHECK(sinkWriter.buffer().empty());
+        BOOST_CHECK(output == expected);
+        BOOST_CHECK_GT(blockCount, 1);
+
+        /* file */
+        BOOST_REQUIRE(Vector::DBC::saveFile(network, "NetworkWriter.dbc"));
+        std::ifstream ifs("NetworkWriter.dbc", std::ios_base::binary);
+        std::ostringstream file;
+        file << ifs.rdbuf();
+        BOOST_CHECK(file.str() == expected);
+        ifs.close();
+        std::remove("NetworkWriter.dbc");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Numbers) {
+    Vector::DBC::Network network;
+    Vector::DBC::Message & message = network.messages[0x80000123];
+    message.id = 0x80000123;
+    message.name = "Message";
+    message.size = 8;
+    const std::vector<double> values {
+        0.0, -0.0, 1.0, -1.0, 0.1, -0.25, 1.0 / 3.0, 123.456, 1e-5, 1e15, -1e15, 999999999999999.0, 1e16, 1e20, 1.5e300,
+        std::numeric_limits<double>::min(), std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() };
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        Vector::DBC::Signal & signal = message.signals["Signal_" + std::to_string(i)];
+        signal.name = "Signal_" + std::to_string(i);
+        signal.startBit = static_cast<uint32_t>(i);
+        signal.bitSize = 1;
+        signal.factor = values[i];
+        signal.offset = -values[i];
+        signal.minimum = values[i] / 7;
+        signal.maximum = values[i] * 3;
+    }
+
+    Vector::DBC::EnvironmentVariable & environmentVariable = network.environmentVariables["EnvVar"];
+    environmentVariable.name = "EnvVar";
+    environmentVariable.type = Vector::DBC::EnvironmentVariable::Type::String;
+    environmentVariable.accessType = Vector::DBC::EnvironmentVariable::AccessType::ReadWrite;
+    environmentVariable.minimum = -2147483648.0;
+    environmentVariable.id = 4294967295;
+
+    Vector::DBC::AttributeDefinition & attributeDefinition = network.attributeDefinitions["Attribute"];
+    attributeDefinition.name = "Attribute";
+    attributeDefinition.valueType.type = Vector::DBC::AttributeValueType::Type::Int;
+    attributeDefinition.valueType.integerValue.minimum = INT32_MIN;
+    attributeDefinition.valueType.integerValue.maximum = INT32_MAX;
+    Vector::DBC::Attribute & attribute = network.attributeValues["Attribute"];
+    attribute.name = "Attribute";
+    attribute.integerValue = INT32_MIN;
+
+    /* numbers as formatted by streams */
+    Vector::DBC::NetworkWriter writer;
+    BOOST_CHECK(writer.write(network));
+    const std::string & output = writer.buffer();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const std::string expected =
+            " SG_ Signal_" + std::to_string(i) + "  : " + std::to_string(i) + "|1@0+" +
+            " (" + streamNumber(values[i]) + "," + streamNumber(-values[i]) + ")" +
+            " [" + streamNumber(values[i] / 7) + "|" + streamNumber(values[i] * 3) + "]";
+        BOOST_CHECK_MESSAGE(output.find(expected) != std::string::npos, expected);
+    }
+    BOOST_CHECK(output.find("EV_ EnvVar: 0 [" + streamNumber(-2147483648.0) + "|0] \"\" 0 4294967295 DUMMY_NODE_VECTOR8003 ") != std::string::npos);
+    BOOST_CHECK(output.find("BA_ \"Attribute\" -2147483648;") != std::string::npos);
+    BOOST_CHECK_EQUAL(output, streamOutput(network));
+}
+
+BOOST_AUTO_TEST_CASE(Errors) {
+    /* undefined attributes throw like operator<< */
+    Vector::DBC::Network network;
+    Vector::DBC::Attribute & attribute = network.attributeValues["Undefined"];
+    attribute.name = "Undefined";
+    Vector::DBC::NetworkWriter writer;
+    BOOST_CHECK_THROW(writer.write(network), std::out_of_range);
+
+    /* sink errors stop output */
+    std::size_t blockCount = 0;
+    Vector::DBC::NetworkWriter failingWriter([&](const char *, std::size_t) {
+        ++blockCount;
+        return false;
+    }, 0x10);
+    BOOST_CHECK(!failingWriter.write(Vector::DBC::Network()));
+    BOOST_CHECK_EQUAL(blockCount, 1);
+    BOOST_CHECK(failingWriter.buffer().empty());
+
+    /* unwritable file */
+    BOOST_CHECK(!Vector::DBC::saveFile(Vector::DBC::Network(), "/nonexistent/NetworkWriter.dbc"));
+}
@@ -0,0 +1,70 @@
+#define BOOST_TEST_MODULE Scanner
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "Vector/DBC.h"
+
+/** check lexical details, which the example databases don't cover */
+BOOST_AUTO_TEST_CASE(Tokens) {
+    std::istringstream iss(
+        "VERSION \"1.0 \\\"beta\\\"\"\r\n"
+        "\r\n"
+        "NS_ : \r\n"
+        "\tNS_DESC_\r\n"
+        "\tCM_\r\n"
+        "\tBA_DEF_\r\n"
+        "\r\n"
+        "BS_:\r\n"
+        "\r\n"
+        "BU_: Node_1 BO_Node\r\n"
+        "\r\n"
+        "// comment between sections\r\n"
+        "\r\n"
+        "BO_ 100 BO_Message: 8 Node_1\r\n"
+        " SG_ SG_Signal m1 : 0|8@1- (1.5E-1,-2) [-1.5e3|+3] \"deg\" Node_1,BO_Node\r\n"
+        " SG_ Mux M : 8|8@1+ (1,0) [.5|255] \"\" Vector__XXX   \r\n"
+        "\r\n"
+        "CM_ SG_ 100 SG_Signal \"say \\\"hi\\\"\r\n"
+        "second line\";\r\n");
+    Vector::DBC::Network network;
+    iss >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+
+    /* strings keep escape sequences and line breaks */
+    BOOST_CHECK_EQUAL(network.version, "1.0 \\\"beta\\\"");
+
+    /* new symbols end with BS_ */
+    BOOST_REQUIRE_EQUAL(network.newSymbols.size(), 3);
+    BOOST_CHECK_EQUAL(network.newSymbols[0], "NS_DESC_");
+    BOOST_CHECK_EQUAL(network.newSymbols[2], "BA_DEF_");
+
+    /* identifiers starting with keywords */
+    BOOST_CHECK_EQUAL(network.nodes.size(), 2);
+    BOOST_CHECK_EQUAL(network.nodes.count("BO_Node"), 1);
+    Vector::DBC::Message & message = network.messages[100];
+    BOOST_CHECK_EQUAL(message.name, "BO_Message");
+    BOOST_REQUIRE_EQUAL(message.signals.size(), 2);
+
+    /* numbers */
+    Vector::DBC::Signal & signal = message.signals["SG_Signal"];
+    BOOST_CHECK(signal.multiplexor == Vector::DBC::Signal::Multiplexor::MultiplexedSignal);
+    BOOST_CHECK_EQUAL(signal.multiplexerSwitchValue, 1);
+    BOOST_CHECK(signal.valueType == Vector::DBC::ValueType::Signed);
+    BOOST_CHECK_CLOSE(signal.factor, 0.15, 0.0001);
+    BOOST_CHECK_EQUAL(signal.offset, -2.0);
+    BOOST_CHECK_EQUAL(signal.minimum, -1500.0);
+    BOOST_CHECK_EQUAL(signal.maximum, 3.0);
+    BOOST_CHECK_EQUAL(signal.unit, "deg");
+    BOOST_CHECK_EQUAL(signal.receivers.size(), 2);
+    BOOST_CHECK_EQUAL(signal.comment, "say \\\"hi\\\"\r\nsecond line");
+    Vector::DBC::Signal & mux = message.signals["Mux"];
+    BOOST_CHECK(mux.multiplexor == Vector::DBC::Signal::Multiplexor::MultiplexorSwitch);
+    BOOST_CHECK_EQUAL(mux.minimum, 0.5);
+    BOOST_CHECK_EQUAL(mux.receivers.size(), 0);
+}
+
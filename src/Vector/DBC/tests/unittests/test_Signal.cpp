@@ -4,6 +4,7 @@
 #endif
 #include <boost/test/unit_test.hpp>
 
+#include <array>
 #include <fstream>
 #include <iterator>
 #include <limits>
@@ -11,6 +12,85 @@
 
 #include <Vector/DBC.h>
 
+/**
+ * Bit-by-bit reference implementation of Signal::decode.
+ *
+ * @return false if the signal doesn't fit into data
+ */
+static bool referenceDecode(const Vector::DBC::Signal & signal, const std::vector<uint8_t> & data, uint64_t & retVal) {
+    retVal = 0;
+    unsigned int srcBit = signal.startBit;
+    if (signal.byteOrder == Vector::DBC::ByteOrder::BigEndian) {
+        unsigned int dstBit = signal.bitSize - 1;
+        for (uint32_t i = 0; i < signal.bitSize; ++i) {
+            if (srcBit / 8 >= data.size())
+                return false;
+            if (data[srcBit / 8] & (1 << (srcBit % 8)))
+                retVal |= (1ULL << dstBit);
+            if ((srcBit % 8) == 0)
+                srcBit += 15;
+            else
+                --srcBit;
+            --dstBit;
+        }
+    } else {
+        unsigned int dstBit = 0;
+        for (uint32_t i = 0; i < signal.bitSize; ++i) {
+            if (srcBit / 8 >= data.size())
+                return false;
+            if (data[srcBit / 8] & (1 << (srcBit % 8)))
+                retVal |= (1ULL << dstBit);
+            ++srcBit;
+            ++dstBit;
+        }
+    }
+    if (signal.valueType == Vector::DBC::ValueType::Signed) {
+        if (retVal & (1ULL << (signal.bitSize - 1))) {
+            for (auto i = signal.bitSize; i < 64; ++i)
+                retVal |= (1ULL << i);
+        }
+    }
+    return true;
+}
+
+/**
+ * Bit-by-bit reference implementation of Signal::encode.
+ *
+ * @return false if the signal doesn't fit into data
+ */
+static bool referenceEncode(const Vector::DBC::Signal & signal, std::vector<uint8_t> & data, uint64_t rawValue) {
+    unsigned int srcBit = signal.startBit;
+    if (signal.byteOrder == Vector::DBC::ByteOrder::BigEndian) {
+        unsigned int dstBit = signal.bitSize - 1;
+        for (uint32_t i = 0; i < signal.bitSize; ++i) {
+            if (srcBit / 8 >= data.size())
+                return false;
+            if (rawValue & (1ULL << dstBit))
+                data[srcBit / 8] |= (1 << (srcBit % 8));
+            else
+                data[srcBit / 8] &= ~(1 << (srcBit % 8));
+            if ((srcBit % 8) == 0)
+                srcBit += 15;
+            else
+                --srcBit;
+            --dstBit;
+        }
+    } else {
+        unsigned int dstBit = 0;
+        for (uint32_t i = 0; i < signal.bitSize; ++i) {
+            if (srcBit / 8 >= data.size())
+                return false;
+            if (rawValue & (1ULL << dstBit))
+                data[srcBit / 8] |= (1 << (srcBit % 8));
+            else
+                data[srcBit / 8] &= ~(1 << (srcBit % 8));
+            ++srcBit;
+            ++dstBit;
+        }
+    }
+    return true;
+}
+
 /**
  * Check raw to physical and vice-versa functions.
  * Check min/max functions.
@@ -82,6 +162,70 @@ BOOST_AUTO_TEST_CASE(SignalDecodeEncode) {
     BOOST_CHECK_EQUAL(data[0], 0x0E);
 }
 
+/**
+ * Check signal decode against the bit-by-bit reference for all
+ * start bits, bit sizes, byte orders and value types.
+ */
+BOOST_AUTO_TEST_CASE(SignalDecodeExhaustive) {
+    /* 16 bytes to also cover signals spanning 9 bytes */
+    std::vector<std::vector<uint8_t>> patterns;
+    patterns.push_back(std::vector<uint8_t>(16, 0x00));
+    patterns.push_back(std::vector<uint8_t>(16, 0xFF));
+    patterns.push_back(std::vector<uint8_t>(16, 0x00));
+    patterns.push_back(std::vector<uint8_t>(16, 0x00));
+    for (uint8_t i = 0; i < 16; ++i) {
+        patterns[2][i] = 0x5A ^ (i * 0x13);
+        patterns[3][i] = (i % 2) ? 0x80 : 0x01;
+    }
+
+    Vector::DBC::Signal signal;
+    for (auto byteOrder : { Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ByteOrder::LittleEndian }) {
+        signal.byteOrder = byteOrder;
+        for (auto valueType : { Vector::DBC::ValueType::Unsigned, Vector::DBC::ValueType::Signed }) {
+            signal.valueType = valueType;
+            for (signal.startBit = 0; signal.startBit < 128; ++signal.startBit) {
+                for (signal.bitSize = 1; signal.bitSize <= 64; ++signal.bitSize) {
+                    for (auto & data : patterns) {
+                        uint64_t expected;
+                        if (!referenceDecode(signal, data, expected))
+                            continue;
+                        BOOST_CHECK_EQUAL(signal.decode(data), expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Check signal encode against the bit-by-bit reference for all
+ * start bits, bit sizes and byte orders.
+ */
+BOOST_AUTO_TEST_CASE(SignalEncodeExhaustive) {
+    /* 16 bytes to also cover signals spanning 9 bytes */
+    std::vector<uint8_t> background(16);
+    for (uint8_t i = 0; i < 16; ++i)
+        background[i] = 0xA5 ^ (i * 0x29);
+    const uint64_t rawValues[] = { 0x0000000000000000, 0xFFFFFFFFFFFFFFFF, 0x0123456789ABCDEF, 0x8000000000000001 };
+
+    Vector::DBC::Signal signal;
+    for (auto byteOrder : { Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ByteOrder::LittleEndian }) {
+        signal.byteOrder = byteOrder;
+        for (signal.startBit = 0; signal.startBit < 128; ++signal.startBit) {
+            for (signal.bitSize = 1; signal.bitSize <= 64; ++signal.bitSize) {
+                for (auto rawValue : rawValues) {
+                    std::vector<uint8_t> expected = background;
+                    if (!referenceEncode(signal, expected, rawValue))
+                        continue;
+                    std::vector<uint8_t> data = background;
+                    signal.encode(data, rawValue);
+                    BOOST_CHECK(data == expected);
+                }
+            }
+        }
+    }
+}
+
 /**
  * Checks that signal decode/encode and raw to physical and vice-versa functions
  * work in combination.
@@ -139,3 +283,75 @@ BOOST_AUTO_TEST_CASE(BothFunctionsCombined) {
     physicalValue = signal.rawToPhysicalValue(rawValue);
     BOOST_CHECK_EQUAL(physicalValue, 116.75);
 }
+
+/**
+ * Check pointer and size based decode/encode on CAN FD frames.
+ */
+BOOST_AUTO_TEST_CASE(SignalDecodeEncodeCanFd) {
+    Vector::DBC::Signal signal;
+    signal.startBit = 500;
+    signal.bitSize = 12;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+
+    /* encode and decode at the end of a 64 byte frame */
+    uint8_t data[64] {};
+    signal.encode(data, sizeof(data), 0xABC);
+    BOOST_CHECK_EQUAL(data[62], 0xC0);
+    BOOST_CHECK_EQUAL(data[63], 0xAB);
+    BOOST_CHECK_EQUAL(signal.decode(data, sizeof(data)), 0xABC);
+
+    /* bytes beyond size are read as zero and not written */
+    BOOST_CHECK_EQUAL(signal.decode(data, 63), 0xC);
+    BOOST_CHECK_EQUAL(signal.decode(data, 32), 0);
+    signal.encode(data, 63, 0x123);
+    BOOST_CHECK_EQUAL(data[62], 0x30);
+    BOOST_CHECK_EQUAL(data[63], 0xAB);
+    signal.encode(data, 8, 0xFFF);
+    BOOST_CHECK_EQUAL(data[62], 0x30);
+
+    /* big endian signal crossing the 32 byte boundary */
+    signal.startBit = 251;
+    signal.bitSize = 16;
+    signal.byteOrder = Vector::DBC::ByteOrder::BigEndian;
+    signal.valueType = Vector::DBC::ValueType::Signed;
+    signal.encode(data, 32, 0xFFFF);
+    BOOST_CHECK_EQUAL(signal.decode(data, 32), 0xFFFFFFFFFFFFF000);
+    signal.encode(data, sizeof(data), 0xFFFF);
+    BOOST_CHECK_EQUAL(signal.decode(data, sizeof(data)), 0xFFFFFFFFFFFFFFFF);
+}
+
+/**
+ * Check span, C array and std::array based decode/encode.
+ */
+BOOST_AUTO_TEST_CASE(SignalDecodeEncodeSpan) {
+    Vector::DBC::Signal signal;
+    signal.startBit = 60;
+    signal.bitSize = 8;
+    signal.byteOrder = Vector::DBC::ByteOrder::LittleEndian;
+    signal.valueType = Vector::DBC::ValueType::Unsigned;
+
+    /* std::array of classic CAN and CAN FD size */
+    std::array<uint8_t, 8> canData {};
+    signal.encode(canData, 0xA5);
+    BOOST_CHECK_EQUAL(canData[7], 0x50);
+    BOOST_CHECK_EQUAL(signal.decode(canData), 0x5);
+    std::array<uint8_t, 64> canFdData {};
+    signal.encode(canFdData, 0xA5);
+    BOOST_CHECK_EQUAL(signal.decode(canFdData), 0xA5);
+
+    /* C array and span on a buffer */
+    uint8_t buffer[16] {};
+    signal.encode(buffer, 0x3C);
+    BOOST_CHECK_EQUAL(signal.decode(buffer), 0x3C);
+    Vector::DBC::Span<uint8_t> span(buffer, 8);
+    BOOST_CHECK_EQUAL(signal.decode(span), 0xC);
+    const uint8_t * constBuffer = buffer;
+    BOOST_CHECK_EQUAL(signal.decode(Vector::DBC::Span<const uint8_t>(constBuffer, sizeof(buffer))), 0x3C);
+    BOOST_CHECK_EQUAL(signal.decode(Vector::DBC::Span<const uint8_t>()), 0);
+
+    /* const std::vector */
+    const std::vector<uint8_t> constData(buffer, buffer + sizeof(buffer));
+    BOOST_CHECK_EQUAL(signal.decode(constData), 0x3C);
+    BOOST_CHECK_EQUAL(Vector::DBC::Span<const uint8_t>(constData).size(), 16);
+}
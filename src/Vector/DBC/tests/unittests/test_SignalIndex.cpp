@@ -0,0 +1,93 @@
+#define BOOST_TEST_MODULE SignalIndex
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+/**
+ * Create a network with signals of the same name in several messages.
+ */
+static void createNetwork(Vector::DBC::Network & network) {
+    for (uint32_t id = 1; id <= 100; ++id) {
+        Vector::DBC::Message & message = network.messages[id];
+        message.id = id;
+        message.name = "Message_" + std::to_string(id);
+        for (uint32_t nr = 0; nr < 8; ++nr) {
+            std::string signalName = "Signal_" + std::to_string(id * 8 + nr);
+            message.signals[signalName].name = signalName;
+        }
+        message.signals["Counter"].name = "Counter";
+    }
+}
+
+/**
+ * Check lookup by signal name and qualified name.
+ */
+BOOST_AUTO_TEST_CASE(SignalIndexFind) {
+    Vector::DBC::Network network;
+    createNetwork(network);
+    Vector::DBC::SignalIndex signalIndex(network);
+
+    /* signal name */
+    const Vector::DBC::SignalReference * signalReference = signalIndex.find("Signal_85");
+    BOOST_REQUIRE(signalReference != nullptr);
+    BOOST_CHECK_EQUAL(signalReference->messageId, 10);
+    BOOST_CHECK_EQUAL(signalReference->message, &network.messages[10]);
+    BOOST_CHECK_EQUAL(signalReference->signal, &network.messages[10].signals["Signal_85"]);
+
+    /* qualified name */
+    signalReference = signalIndex.find("Message_10.Signal_85");
+    BOOST_REQUIRE(signalReference != nullptr);
+    BOOST_CHECK_EQUAL(signalReference->signal, &network.messages[10].signals["Signal_85"]);
+    signalReference = signalIndex.find("Message_42.Counter");
+    BOOST_REQUIRE(signalReference != nullptr);
+    BOOST_CHECK_EQUAL(signalReference->messageId, 42);
+
+    /* ambiguous name returns message with lowest identifier */
+    signalReference = signalIndex.find("Counter");
+    BOOST_REQUIRE(signalReference != nullptr);
+    BOOST_CHECK_EQUAL(signalReference->messageId, 1);
+    auto signalReferences = signalIndex.findAll("Counter");
+    BOOST_REQUIRE_EQUAL(signalReferences.second - signalReferences.first, 100);
+    for (const Vector::DBC::SignalReference * it = signalReferences.first; it != signalReferences.second; ++it)
+        BOOST_CHECK_EQUAL(it->messageId, static_cast<uint32_t>(it - signalReferences.first + 1));
+
+    /* unknown names */
+    BOOST_CHECK(signalIndex.find("Signal_7") == nullptr);
+    BOOST_CHECK(signalIndex.find("Message_10.Signal_7") == nullptr);
+    BOOST_CHECK(signalIndex.find("Message_0.Counter") == nullptr);
+    BOOST_CHECK(signalIndex.findAll("Signal_7").first == nullptr);
+}
+
+/**
+ * Check that concurrent first queries are safe.
+ */
+BOOST_AUTO_TEST_CASE(SignalIndexThreads) {
+    Vector::DBC::Network network;
+    createNetwork(network);
+    Vector::DBC::SignalIndex signalIndex(network);
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&signalIndex, &failures, t]() {
+            for (uint32_t id = 1; id <= 100; ++id) {
+                std::string name = "Message_" + std::to_string(id) + ".Signal_" + std::to_string(id * 8 + t);
+                const Vector::DBC::SignalReference * signalReference = signalIndex.find(name);
+                if ((signalReference == nullptr) || (signalReference->messageId != id))
+                    ++failures;
+            }
+        });
+    }
+    for (auto & thread : threads)
+        thread.join();
+    BOOST_CHECK_EQUAL(failures, 0);
+}
@@ -0,0 +1,156 @@
+#define BOOST_TEST_MODULE Snapshot
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+
+#include <Vector/DBC.h>
+
+#include "AlignedSnapshot.h"
+
+BOOST_AUTO_TEST_CASE(File) {
+    /* create output directory */
+    boost::filesystem::path outdir(CMAKE_CURRENT_BINARY_DIR "/data/");
+    if (!exists(outdir))
+        BOOST_REQUIRE(create_directory(outdir));
+
+    for (const std::string name : { "Database", "ExtendedMultiplexing", "MessageSeparation" }) {
+        /* load database file */
+        Vector::DBC::Network network;
+        BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/" + name + ".dbc"));
+        std::ostringstream expected;
+        expected << network;
+
+        /* save and load snapshot file */
+        const std::string snapshotFile = CMAKE_CURRENT_BINARY_DIR "/data/" + name + ".snapshot";
+        BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, snapshotFile));
+        Vector::DBC::Network loadedNetwork;
+        BOOST_REQUIRE(Vector::DBC::loadSnapshot(loadedNetwork, snapshotFile));
+        BOOST_CHECK(loadedNetwork.successfullyParsed);
+
+        /* loaded network should be equivalent */
+        std::ostringstream actual;
+        actual << loadedNetwork;
+        BOOST_CHECK(actual.str() == expected.str());
+
+        /* snapshots are reproducible */
+        std::ostringstream snapshot1;
+        std::ostringstream snapshot2;
+        BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, snapshot1));
+        BOOST_REQUIRE(Vector::DBC::saveSnapshot(loadedNetwork, snapshot2));
+        BOOST_CHECK(snapshot1.str() == snapshot2.str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Content) {
+    std::istringstream iss(
+        "VERSION \"1.0\"\n\n"
+        "NS_ :\n\tCM_\n\nBS_:\n\nBU_: Node_1\n\n"
+        "BO_ 100 Message_1: 8 Node_1\n"
+        " SG_ Signal_1 : 0|8@1- (0.5,-1) [-10|10] \"unit\" Node_1\n\n"
+        "CM_ BO_ 200 \"Comment of undefined message\";\n"
+        "BA_DEF_ BO_  \"FloatAttribute\" FLOAT -1.5 1.5;\n"
+        "BA_DEF_ SG_  \"IntAttribute\" INT -10 10;\n"
+        "BA_DEF_DEF_  \"FloatAttribute\" 0.25;\n"
+        "BA_DEF_DEF_  \"IntAttribute\" -3;\n"
+        "BA_ \"FloatAttribute\" BO_ 100 -0.75;\n"
+        "BA_ \"IntAttribute\" SG_ 100 Signal_1 -7;\n"
+        "VAL_ 100 Signal_1 1 \"On\" 0 \"Off\" ;\n");
+    Vector::DBC::Network network;
+    iss >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+
+    std::ostringstream oss;
+    BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, oss));
+    AlignedSnapshot snapshot(oss.str());
+    Vector::DBC::Network loadedNetwork;
+    BOOST_REQUIRE(Vector::DBC::loadSnapshot(loadedNetwork, snapshot.data(), snapshot.size));
+
+    /* message created by comment keeps its key */
+    BOOST_REQUIRE_EQUAL(loadedNetwork.messages.size(), 2);
+    BOOST_CHECK_EQUAL(loadedNetwork.messages[200].comment, "Comment of undefined message");
+    BOOST_CHECK_EQUAL(loadedNetwork.messages[200].id, network.messages[200].id);
+
+    /* signal */
+    const Vector::DBC::Signal & signal = loadedNetwork.messages[100].signals["Signal_1"];
+    BOOST_CHECK(signal.valueType == Vector::DBC::ValueType::Signed);
+    BOOST_CHECK(signal.byteOrder == Vector::DBC::ByteOrder::LittleEndian);
+    BOOST_CHECK_EQUAL(signal.factor, 0.5);
+    BOOST_CHECK_EQUAL(signal.offset, -1.0);
+    BOOST_CHECK_EQUAL(signal.unit, "unit");
+    BOOST_CHECK_EQUAL(signal.valueDescriptions.at(1), "On");
+
+    /* attribute values of different types */
+    BOOST_CHECK_EQUAL(loadedNetwork.attributeDefinitions["FloatAttribute"].valueType.floatValue.minimum, -1.5);
+    BOOST_CHECK_EQUAL(loadedNetwork.attributeDefinitions["IntAttribute"].valueType.integerValue.minimum, -10);
+    BOOST_CHECK_EQUAL(loadedNetwork.attributeDefaults["FloatAttribute"].floatValue, 0.25);
+    BOOST_CHECK_EQUAL(loadedNetwork.attributeDefaults["IntAttribute"].integerValue, -3);
+    BOOST_CHECK_EQUAL(loadedNetwork.messages[100].attributeValues["FloatAttribute"].floatValue, -0.75);
+    BOOST_CHECK_EQUAL(signal.attributeValues.at("IntAttribute").integerValue, -7);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid) {
+    Vector::DBC::Network network;
+    BOOST_REQUIRE(Vector::DBC::loadFile(network, CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc"));
+    std::ostringstream oss;
+    BOOST_REQUIRE(Vector::DBC::saveSnapshot(network, oss));
+    const std::string snapshot = oss.str();
+
+    /* valid snapshot */
+    Vector::DBC::Snapshot validSnapshot;
+    AlignedSnapshot valid(snapshot);
+    BOOST_REQUIRE(validSnapshot.open(valid.data(), valid.size));
+    BOOST_CHECK_EQUAL(validSnapshot.records<Vector::DBC::SnapshotFormat::NetworkRecord>().size(), 1);
+
+    /* truncated */
+    Vector::DBC::Network loadedNetwork;
+    AlignedSnapshot truncated(snapshot.substr(0, snapshot.size() - 8));
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, truncated.data(), truncated.size));
+    BOOST_CHECK(!loadedNetwork.successfullyParsed);
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, valid.data(), 16));
+
+    /* misaligned */
+    std::vector<uint64_t> buffer(valid.buffer.size() + 1);
+    char * misaligned = reinterpret_cast<char *>(buffer.data()) + 4;
+    std::memcpy(misaligned, snapshot.data(), snapshot.size());
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, misaligned, snapshot.size()));
+
+    /* wrong magic or version */
+    std::string corrupted = snapshot;
+    corrupted[0] = 'X';
+    AlignedSnapshot wrongMagic(corrupted);
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, wrongMagic.data(), wrongMagic.size));
+    corrupted = snapshot;
+    corrupted[offsetof(Vector::DBC::SnapshotFormat::Header, version)] = static_cast<char>(Vector::DBC::SnapshotFormat::version - 1);
+    AlignedSnapshot wrongVersion(corrupted);
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, wrongVersion.data(), wrongVersion.size));
+
+    /* string outside of string section */
+    const Vector::DBC::SnapshotFormat::NetworkRecord * networkRecord = validSnapshot.records<Vector::DBC::SnapshotFormat::NetworkRecord>().data();
+    const std::size_t versionOffset = reinterpret_cast<const char *>(&networkRecord->version) - valid.data();
+    corrupted = snapshot;
+    const uint32_t invalidLength = 0xffffffff;
+    std::memcpy(&corrupted[versionOffset + offsetof(Vector::DBC::SnapshotFormat::String, length)], &invalidLength, sizeof(invalidLength));
+    AlignedSnapshot invalidString(corrupted);
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, invalidString.data(), invalidString.size));
+
+    /* range outside of section */
+    const std::size_t messagesOffset = reinterpret_cast<const char *>(&networkRecord->messages) - valid.data();
+    corrupted = snapshot;
+    const uint32_t invalidCount = network.messages.size() + 1;
+    std::memcpy(&corrupted[messagesOffset + offsetof(Vector::DBC::SnapshotFormat::Range, count)], &invalidCount, sizeof(invalidCount));
+    AlignedSnapshot invalidRange(corrupted);
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, invalidRange.data(), invalidRange.size));
+
+    /* missing file */
+    BOOST_CHECK(!Vector::DBC::loadSnapshot(loadedNetwork, std::string(CMAKE_CURRENT_BINARY_DIR "/data/Missing.snapshot")));
+}
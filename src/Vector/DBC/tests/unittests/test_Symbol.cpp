@@ -0,0 +1,106 @@
+#define BOOST_TEST_MODULE Symbol
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Vector/DBC.h>
+
+BOOST_AUTO_TEST_CASE(Interning) {
+    /* equal strings share one interned string */
+    const Vector::DBC::Symbol symbol1("Node_1");
+    const Vector::DBC::Symbol symbol2(std::string("Node_1"));
+    const Vector::DBC::Symbol symbol3("Node_2");
+    BOOST_CHECK(symbol1 == symbol2);
+    BOOST_CHECK_EQUAL(&symbol1.str(), &symbol2.str());
+    BOOST_CHECK(symbol1 != symbol3);
+    BOOST_CHECK_EQUAL(symbol1, "Node_1");
+    BOOST_CHECK_EQUAL(symbol1, std::string("Node_1"));
+    BOOST_CHECK_EQUAL(sizeof(Vector::DBC::Symbol), sizeof(void *));
+
+    /* empty symbols */
+    BOOST_CHECK(Vector::DBC::Symbol().empty());
+    BOOST_CHECK(Vector::DBC::Symbol() == Vector::DBC::Symbol(""));
+
+    /* ordering is the ordering of the strings */
+    const std::set<Vector::DBC::Symbol> symbols { "c", "a", "b", "a" };
+    BOOST_REQUIRE_EQUAL(symbols.size(), 3);
+    BOOST_CHECK_EQUAL(*symbols.begin(), "a");
+    BOOST_CHECK_EQUAL(*symbols.rbegin(), "c");
+}
+
+BOOST_AUTO_TEST_CASE(Lookup) {
+    /* find doesn't intern */
+    Vector::DBC::Symbol symbol;
+    BOOST_CHECK(!Vector::DBC::Symbol::find("Lookup_1", symbol));
+    BOOST_CHECK(!Vector::DBC::Symbol::find("Lookup_1", symbol));
+    BOOST_CHECK(symbol.empty());
+    const Vector::DBC::Symbol symbol1("Lookup_1");
+    BOOST_CHECK(Vector::DBC::Symbol::find("Lookup_1", symbol));
+    BOOST_CHECK(symbol == symbol1);
+
+    /* lookups in maps and sets of symbols don't intern */
+    std::set<Vector::DBC::Symbol> symbols { symbol1 };
+    BOOST_CHECK_EQUAL(symbols.count("Lookup_2"), 0);
+    BOOST_CHECK(symbols.find(std::string("Lookup_2")) == symbols.end());
+    BOOST_CHECK(!Vector::DBC::Symbol::find("Lookup_2", symbol));
+    BOOST_CHECK_EQUAL(symbols.count("Lookup_1"), 1);
+    BOOST_CHECK(symbols.find(std::string("Lookup_1")) == symbols.begin());
+    Vector::DBC::Signal signal;
+    BOOST_CHECK_EQUAL(signal.receivers.count("Lookup_3"), 0);
+    BOOST_CHECK(signal.attributeValues.find(std::string("Lookup_3")) == signal.attributeValues.end());
+    BOOST_CHECK(!Vector::DBC::Symbol::find("Lookup_3", symbol));
+}
+
+BOOST_AUTO_TEST_CASE(Threads) {
+    /* all threads get the same interned strings */
+    std::vector<std::vector<Vector::DBC::Symbol>> results(4);
+    std::vector<std::thread> threads;
+    for (std::vector<Vector::DBC::Symbol> & result : results) {
+        threads.emplace_back([&result]() {
+            for (int i = 0; i < 1000; ++i)
+                result.emplace_back("Thread_" + std::to_string(i));
+        });
+    }
+    for (std::thread & thread : threads)
+        thread.join();
+    for (const std::vector<Vector::DBC::Symbol> & result : results) {
+        for (std::size_t i = 0; i < result.size(); ++i)
+            BOOST_CHECK(result[i] == results[0][i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Parser) {
+    std::istringstream iss(
+        "VERSION \"\"\n\nNS_ :\n\nBS_:\n\nBU_: Node_1 Node_2\n\n"
+        "BO_ 1 Message_1: 8 Node_1\n"
+        " SG_ Signal_1 : 0|8@1+ (1,0) [0|0] \"\" Node_2\n"
+        " SG_ Signal_2 : 8|8@1+ (1,0) [0|0] \"\" Node_1,Node_2\n\n"
+        "BO_ 2 Message_2: 8 Node_2\n"
+        " SG_ Signal_1 : 0|8@1+ (1,0) [0|0] \"\" Node_2\n\n"
+        "BA_DEF_ SG_  \"SignalAttribute\" INT 0 10;\n"
+        "BA_ \"SignalAttribute\" SG_ 1 Signal_1 1;\n"
+        "BA_ \"SignalAttribute\" SG_ 2 Signal_1 2;\n");
+    Vector::DBC::Network network;
+    iss >> network;
+    BOOST_REQUIRE(network.successfullyParsed);
+
+    /* receivers, transmitters and attribute names are interned */
+    const Vector::DBC::Signal & signal1 = network.messages[1].signals["Signal_1"];
+    const Vector::DBC::Signal & signal2 = network.messages[2].signals["Signal_1"];
+    BOOST_CHECK_EQUAL(&signal1.receivers.begin()->str(), &signal2.receivers.begin()->str());
+    BOOST_CHECK_EQUAL(&network.messages[2].transmitter.str(), &signal2.receivers.begin()->str());
+    BOOST_CHECK_EQUAL(&signal1.attributeValues.at("SignalAttribute").name.str(), &signal2.attributeValues.at("SignalAttribute").name.str());
+    BOOST_CHECK_EQUAL(signal2.attributeValues.at("SignalAttribute").integerValue, 2);
+
+    /* output is the same as with strings */
+    std::ostringstream oss;
+    oss << network;
+    BOOST_CHECK(oss.str().find("\"\"  Node_1 Node_2") != std::string::npos);
+}
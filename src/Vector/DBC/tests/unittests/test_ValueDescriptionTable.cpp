@@ -0,0 +1,77 @@
+#define BOOST_TEST_MODULE ValueDescriptionTable
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <memory>
+
+#include <Vector/DBC.h>
+
+BOOST_AUTO_TEST_CASE(Dense) {
+    Vector::DBC::ValueDescriptions valueDescriptions;
+    valueDescriptions[10] = "Off";
+    valueDescriptions[11] = "On";
+    valueDescriptions[13] = "Error";
+    const Vector::DBC::ValueDescriptionTable table(valueDescriptions);
+    BOOST_CHECK(table.isDense());
+    BOOST_CHECK_EQUAL(table.size(), 3);
+    BOOST_CHECK_EQUAL(table.find(10), "Off");
+    BOOST_CHECK_EQUAL(table.find(11), "On");
+    BOOST_CHECK(table.find(12).empty());
+    BOOST_CHECK_EQUAL(table.find(13), "Error");
+    BOOST_CHECK(table.find(9).empty());
+    BOOST_CHECK(table.find(14).empty());
+    BOOST_CHECK(table.find(UINT64_C(0x10000000A)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Sparse) {
+    Vector::DBC::ValueDescriptions valueDescriptions;
+    valueDescriptions[0] = "Zero";
+    valueDescriptions[1000] = "Thousand";
+    valueDescriptions[0xFFFFFFFF] = "Minus One";
+    const Vector::DBC::ValueDescriptionTable table(valueDescriptions);
+    BOOST_CHECK(!table.isDense());
+    BOOST_CHECK_EQUAL(table.size(), 3);
+    BOOST_CHECK_EQUAL(table.find(0), "Zero");
+    BOOST_CHECK_EQUAL(table.find(1000), "Thousand");
+    BOOST_CHECK(table.find(999).empty());
+    BOOST_CHECK(table.find(1001).empty());
+
+    /* sign extended negative values */
+    BOOST_CHECK_EQUAL(table.find(0xFFFFFFFF), "Minus One");
+    BOOST_CHECK_EQUAL(table.find(UINT64_MAX), "Minus One");
+    BOOST_CHECK(table.find(UINT64_C(0x1FFFFFFFF)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(SharedPool) {
+    auto pool = std::make_shared<Vector::DBC::StringPool>();
+    Vector::DBC::ValueDescriptions valueDescriptions1;
+    valueDescriptions1[0] = "Off";
+    valueDescriptions1[1] = "On";
+    Vector::DBC::ValueDescriptions valueDescriptions2;
+    valueDescriptions2[0] = "On";
+    valueDescriptions2[500] = "Off";
+    const Vector::DBC::ValueDescriptionTable table1(valueDescriptions1, pool);
+    const Vector::DBC::ValueDescriptionTable table2(valueDescriptions2, pool);
+
+    /* equal labels are stored once */
+    BOOST_CHECK_EQUAL(pool->size(), 5);
+    BOOST_CHECK_EQUAL(table1.find(0).data(), table2.find(500).data());
+    BOOST_CHECK_EQUAL(table1.find(1).data(), table2.find(0).data());
+
+    /* copies share the pool */
+    const Vector::DBC::ValueDescriptionTable table3 = table2;
+    BOOST_CHECK_EQUAL(table3.find(500).data(), table2.find(500).data());
+}
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const Vector::DBC::ValueDescriptionTable table;
+    BOOST_CHECK(table.empty());
+    BOOST_CHECK(table.find(0).empty());
+
+    const Vector::DBC::ValueDescriptionTable emptyTable { Vector::DBC::ValueDescriptions() };
+    BOOST_CHECK(emptyTable.empty());
+    BOOST_CHECK(emptyTable.find(0).empty());
+}